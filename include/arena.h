@@ -22,8 +22,13 @@ extern "C" {
  * - Bulk deallocation (free entire chain at once)
  * - Cross-platform (Windows/Linux/macOS)
  * - **SAFE**: Existing pointers never invalidated by new allocations
+ * - Optional aligned chunks (cache line or page) for SIMD output buffers
  */
 
+/* Chunk alignment for arena_init_aligned(): one cache line or the system page */
+#define ARENA_ALIGN_CACHE_LINE ((size_t)64)
+#define ARENA_ALIGN_PAGE       ((size_t)0)
+
 /* Opaque pointer to internal chunk structure */
 typedef struct ArenaChunk ArenaChunk;
 
@@ -31,6 +36,7 @@ typedef struct {
     ArenaChunk *first;   /* First chunk in chain */
     ArenaChunk *current; /* Current chunk for allocation */
     size_t chunk_size;   /* Size of new chunks to allocate */
+    size_t chunk_align;  /* Alignment of chunk data, 0 = malloc default */
 } Arena;
 
 /**
@@ -42,6 +48,20 @@ typedef struct {
  */
 void arena_init(Arena *arena, size_t initial_size);
 
+/**
+ * Initialize an arena whose chunks start on an aligned boundary
+ * Every chunk's data begins at a multiple of chunk_align, so vector stores
+ * into arena memory never split a cache line (or a page) at chunk starts.
+ * Chunk capacities are rounded up to a multiple of the alignment (whole
+ * pages in page mode).
+ * Exits on allocation failure or if chunk_align is not a power of two
+ *
+ * @param arena Pointer to arena structure
+ * @param initial_size Initial capacity in bytes
+ * @param chunk_align ARENA_ALIGN_CACHE_LINE, ARENA_ALIGN_PAGE or any power of two
+ */
+void arena_init_aligned(Arena *arena, size_t initial_size, size_t chunk_align);
+
 /**
  * Reserve capacity in the arena
  * Pre-allocates chunks to minimize allocations during parsing
@@ -64,6 +84,20 @@ void arena_reserve(Arena *arena, size_t total_needed);
  */
 char *arena_alloc(Arena *arena, size_t size);
 
+/**
+ * Allocate aligned memory from the arena
+ * Skips at most align - 1 bytes of the current chunk; works in any arena,
+ * but in an arena whose chunk alignment is at least align, fresh chunks
+ * need no padding at all
+ * Exits on allocation failure or if align is not a power of two
+ *
+ * @param arena Pointer to arena structure
+ * @param size Number of bytes to allocate
+ * @param align Required alignment in bytes (power of two)
+ * @return Pointer to allocated memory, a multiple of align (never NULL)
+ */
+char *arena_alloc_aligned(Arena *arena, size_t size, size_t align);
+
 /**
  * Duplicate a string in the arena
  * Exits on allocation failure or if str is NULL
@@ -100,6 +134,16 @@ void arena_reset(Arena *arena);
  */
 void arena_free(Arena *arena);
 
+/**
+ * Move all chunks of one arena to the end of another
+ * Pointers into src stay valid and are owned by dst afterwards;
+ * src is left empty (as after arena_free) and may be re-initialized
+ *
+ * @param dst Arena receiving the chunks
+ * @param src Arena giving up its chunks
+ */
+void arena_merge(Arena *dst, Arena *src);
+
 /**
  * Get the current memory usage of the arena
  * Walks the chunk chain to sum up used bytes
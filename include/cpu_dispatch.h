@@ -0,0 +1,69 @@
+#ifndef CPU_DISPATCH_H
+#define CPU_DISPATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Runtime selection of SIMD code paths
+ *
+ * The library is compiled for the baseline x86-64 ISA. Hot kernels also
+ * exist in SSE4.2, AVX2 and AVX-512 variants, compiled with per-function
+ * target attributes and chosen at run time from cpuid. The environment
+ * variable LIBERG_SIMD (scalar, sse42, avx2, avx512) caps the level, so
+ * every path can be forced and tested on one machine.
+ */
+
+/* Supported SIMD levels, in increasing order */
+typedef enum {
+    CPU_SIMD_SCALAR = 0,  /* Portable C only */
+    CPU_SIMD_SSE42  = 1,  /* SSE4.2 + POPCNT */
+    CPU_SIMD_AVX2   = 2,  /* AVX2 + FMA + BMI2 */
+    CPU_SIMD_AVX512 = 3,  /* AVX-512 F/BW/VL/DQ */
+    CPU_SIMD_LEVELS = 4
+} CpuSimdLevel;
+
+/* Per-function target attributes for the kernel variants */
+#if defined(__GNUC__) || defined(__clang__)
+#define CPU_TARGET_SSE42  __attribute__((target("sse4.2,popcnt")))
+#define CPU_TARGET_AVX2   __attribute__((target("avx2,fma,bmi,bmi2,popcnt")))
+#define CPU_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512vl,avx512dq,avx2,fma,bmi,bmi2,popcnt")))
+#else
+/* MSVC accepts every intrinsic without target flags */
+#define CPU_TARGET_SSE42
+#define CPU_TARGET_AVX2
+#define CPU_TARGET_AVX512
+#endif
+
+/**
+ * Highest level supported by the CPU and operating system (cpuid + xgetbv)
+ * Detected once, thread-safe
+ */
+CpuSimdLevel cpu_simd_detect(void);
+
+/**
+ * Level used by the kernels: cpu_simd_detect() capped by LIBERG_SIMD
+ * Unknown values of LIBERG_SIMD are ignored
+ */
+CpuSimdLevel cpu_simd_level(void);
+
+/**
+ * Force a level for testing and benchmarking (capped at cpu_simd_detect())
+ * Not synchronized with running kernels: call it between operations
+ *
+ * @param level Requested level
+ * @return Level now in use
+ */
+CpuSimdLevel cpu_simd_set_level(CpuSimdLevel level);
+
+/**
+ * Name of a level as accepted by LIBERG_SIMD ("scalar", "sse42", "avx2", "avx512")
+ */
+const char *cpu_simd_level_name(CpuSimdLevel level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_DISPATCH_H */
@@ -39,14 +39,129 @@ typedef enum {
  * Metadata for a single signal/channel
  */
 typedef struct {
-    char*        name;      /* Signal name (e.g., "Time", "Car.v") */
-    ERGDataType  type;      /* Data type */
-    size_t       type_size; /* Size in bytes */
-    char*        unit;      /* Unit string (e.g., "m/s", "s") */
-    double       factor;    /* Scaling factor */
-    double       offset;    /* Scaling offset */
+    char*        name;       /* Signal name (e.g., "Time", "Car.v") */
+    ERGDataType  type;       /* Data type */
+    size_t       type_size;  /* Size in bytes */
+    char*        unit;       /* Unit string (e.g., "m/s", "s") */
+    double       factor;     /* Scaling factor */
+    double       offset;     /* Scaling offset */
+    size_t       row_offset; /* Byte offset of this signal within a data row */
 } ERGSignal;
 
+/**
+ * Slot in the open-addressing signal name index
+ * Stores the full hash so probes only compare names on a hash match
+ */
+typedef struct {
+    uint32_t     hash;       /* FNV-1a hash of the signal name */
+    uint32_t     index;      /* Signal index + 1 (0 = empty slot) */
+} ERGSignalSlot;
+
+/**
+ * Index over a non-decreasing column (e.g. "Time", "Vhcl.sRoad")
+ * Maps key values to sample positions without materializing the column.
+ * A uniformly sampled column is detected from a few probes and answers
+ * in O(1); otherwise lookups gallop from the previous result (cached
+ * binary search). Keys are compared after scaling (factor/offset).
+ */
+typedef struct {
+    size_t       signal_index; /* Indexed signal */
+    size_t       sample_count; /* Samples covered (0 = index not valid) */
+    double       first;        /* Key of the first sample */
+    double       last;         /* Key of the last sample */
+    double       step;         /* Key step between samples if uniform */
+    int          uniform;      /* 1 if the column looks uniformly sampled */
+    size_t       hint;         /* Result of the previous lookup */
+} ERGKeyIndex;
+
+/**
+ * One bucket of a min/max decimated signal (scaled values)
+ * Drawing a vertical line from min to max per bucket renders the same
+ * envelope as the full-resolution data
+ */
+typedef struct {
+    double       min;          /* Smallest sample in the bucket (NaN if all NaN) */
+    double       max;          /* Largest sample in the bucket (NaN if all NaN) */
+    double       first;        /* First sample in the bucket */
+    double       last;         /* Last sample in the bucket */
+} ERGBucket;
+
+/**
+ * Descriptive statistics of one signal (scaled values)
+ * min, max, mean and variance cover the finite samples only
+ */
+typedef struct {
+    double       min;          /* Smallest finite sample (NaN if none) */
+    double       max;          /* Largest finite sample (NaN if none) */
+    double       mean;         /* Mean of finite samples (NaN if none) */
+    double       variance;     /* Population variance of finite samples (NaN if none) */
+    size_t       count;        /* Number of finite samples */
+    size_t       nan_count;    /* Number of NaN samples */
+    size_t       inf_count;    /* Number of +/-Inf samples */
+    double       first;        /* First sample (NaN if no samples) */
+    double       last;         /* Last sample (NaN if no samples) */
+} ERGStats;
+
+/* Maximum number of levels in a LOD pyramid */
+#define ERG_LOD_MAX_LEVELS 48
+
+/**
+ * Multi-resolution min/max pyramid, persisted in a <file>.erg.lod sidecar
+ * Level l holds min/max per bucket of (base_bucket << l) samples for every
+ * signal, so a decimated view costs O(buckets shown) at any zoom level.
+ * The sidecar records the size and sub-second mtime of the .erg and the
+ * .erg.info (the pyramid holds scaled values) and is rebuilt when any changes.
+ */
+typedef struct {
+    const double* data;           /* Pyramids, signal_stride doubles per signal */
+    size_t        signal_count;   /* Number of signals covered */
+    size_t        sample_count;   /* Number of samples covered */
+    size_t        base_bucket;    /* Samples per level-0 bucket */
+    size_t        level_count;    /* Number of levels */
+    size_t        signal_stride;  /* Doubles per signal pyramid */
+    size_t        level_buckets[ERG_LOD_MAX_LEVELS]; /* Buckets per level */
+    size_t        level_offset[ERG_LOD_MAX_LEVELS];  /* Offset of each level in a pyramid (doubles) */
+    void*         mapped_data;    /* Sidecar mapping (NULL if held in memory) */
+    size_t        mapped_size;    /* Size of sidecar mapping */
+    double*       owned_data;     /* Heap copy when the sidecar could not be written */
+} ERGLod;
+
+/**
+ * Access pattern hint for the data mapping (madvise)
+ */
+typedef enum {
+    ERG_ADVICE_NORMAL,      // Kernel default readahead
+    ERG_ADVICE_SEQUENTIAL,  // Aggressive readahead, early reclaim (full scans)
+    ERG_ADVICE_RANDOM       // No readahead (sparse range reads, index lookups)
+} ERGAccessAdvice;
+
+/**
+ * How erg_parse() maps the data file (see erg_parse_with_options())
+ * All zero is the default: demand-faulted mapping with no advice.
+ * Options the platform does not support are ignored.
+ */
+typedef struct {
+    int             populate;     /* Prefault the whole mapping at open (MAP_POPULATE) */
+    ERGAccessAdvice advice;       /* Access pattern hint for the mapping */
+    int             huge_pages;   /* Ask for transparent huge pages (MADV_HUGEPAGE) */
+    int             prefetch;     /* Start asynchronous readahead of the data region (MADV_WILLNEED) */
+    int             drop_behind;  /* Release the data pages after each full-column scan */
+    int             use_index;    /* Open from the <file>.erg.idx schema cache, (re)writing it if stale */
+    int             index_stats;  /* Also store per-signal statistics when writing the cache */
+} ERGOpenOptions;
+
+/**
+ * How erg_open_async() reads the file
+ * All zero selects the defaults.
+ */
+typedef struct {
+    int             direct_io;    /* Bypass the page cache (O_DIRECT / FILE_FLAG_NO_BUFFERING) */
+    size_t          block_size;   /* Bytes per read request (0 = 4 MB, rounded up to 4 KB) */
+    size_t          queue_depth;  /* Reads in flight, one reader thread each (0 = 4) */
+} ERGReadOptions;
+
+/* Opaque handle of an open in progress (see erg_open_async()) */
+typedef struct ERGAsyncOpen ERGAsyncOpen;
 
 /**
  * Main ERG file structure
@@ -55,23 +170,38 @@ typedef struct {
  */
 typedef struct {
     char*         erg_path;       /* Path to .erg file */
-    InfoFile*     info;           /* Parsed .erg.info file */
+    InfoFile*     info;           /* Parsed .erg.info file (NULL when opened from the .erg.idx cache) */
 
     ERGSignal*    signals;        /* Array of signal metadata */
     size_t        signal_count;   /* Number of signals */
+    ERGSignalSlot* signal_slots;  /* Name index (power-of-two size, built by erg_parse) */
+    size_t        slot_mask;      /* Number of index slots - 1 */
 
     size_t        data_offset;    /* Offset to data in file (after header) */
     size_t        data_size;      /* Size of data in file */
     size_t        sample_count;   /* Number of samples/rows */
 
     int           little_endian;  /* 1 if little-endian, 0 if big-endian */
+    int           follow_mode;    /* Set before erg_parse() for files still being written */
+    ERGOpenOptions open_options;  /* Mapping policy (see erg_parse_with_options()) */
     size_t        row_size;       /* Size of one data row in bytes */
 
     Arena         metadata_arena; /* Arena for all string allocations */
 
+    ERGKeyIndex   time_index;     /* Index over "Time" (sample_count 0 if absent) */
+
+    /* Schema cache (see ERGOpenOptions.use_index) */
+    void*         index_data;     /* Mapped .erg.idx (signal names and units point into it), NULL if unused */
+    size_t        index_size;     /* Size of the .erg.idx mapping */
+    ERGStats*     cached_stats;   /* Per-signal statistics stored in the cache, NULL if absent */
+
+    /* Optional column-major copy of the data region (see erg_enable_columnar) */
+    void*         columnar_data;  /* Signal starts at row_offset * sample_count, NULL if disabled */
+
     /* Memory-mapped file data */
     void*         mapped_data;    /* Memory-mapped file data (NULL if not mapped) */
     size_t        mapped_size;    /* Size of mapped region */
+    void*         read_buffer;    /* File read into memory by erg_open_async() (aliases mapped_data), NULL if mapped */
 #ifdef _WIN32
     void*         file_handle;    /* Windows file handle (HANDLE) */
     void*         mapping_handle; /* Windows mapping handle (HANDLE) */
@@ -80,6 +210,33 @@ typedef struct {
 #endif
 } ERG;
 
+/* ERGIterator flags */
+#define ERG_ITER_DROP_BEHIND 0x1  /* Release pages behind the cursor (RSS and page cache) */
+#define ERG_ITER_WINDOW      0x2  /* Read through a sliding mapping instead of the full-file one */
+
+/**
+ * Streaming cursor over the rows of an ERG file, one block at a time
+ * Memory use is bounded by the block size: with ERG_ITER_DROP_BEHIND pages
+ * already consumed are returned to the OS, and with ERG_ITER_WINDOW only
+ * the part of the file around the current block is mapped.
+ */
+typedef struct {
+    const ERG*    erg;            /* ERG being iterated */
+    size_t        block_rows;     /* Rows per block */
+    size_t        next_row;       /* First row of the next block */
+    size_t        first_row;      /* First row of the current block */
+    size_t        rows;           /* Rows in the current block */
+    const uint8_t* row_data;      /* Current block, row-major (row_size bytes per row) */
+    size_t*       columns;        /* Selected signal indices */
+    size_t        column_count;   /* Number of selected signals */
+    void**        column_data;    /* Current block per selected signal (native type, scaled) */
+    int           flags;          /* ERG_ITER_* flags */
+    size_t        released;       /* File bytes before this offset have been released */
+    void*         window;         /* Sliding mapping (ERG_ITER_WINDOW), NULL if none */
+    size_t        window_offset;  /* File offset of the sliding mapping */
+    size_t        window_size;    /* Size of the sliding mapping */
+} ERGIterator;
+
 /**
  * Initialize an ERG structure
  * Does not load data - call erg_parse() to load
@@ -96,10 +253,85 @@ void erg_init(ERG* erg, const char* erg_file_path);
  */
 void erg_parse(ERG* erg);
 
+/**
+ * Parse the ERG file with an explicit mapping policy
+ * Same as erg_parse() after copying options into erg->open_options.
+ * Cold-read latency is dominated by page faults: populate or prefetch
+ * trade open time for fault-free reads, and sequential/random advice
+ * tunes kernel readahead to the expected access pattern.
+ * With use_index, a current <file>.erg.idx (matching .erg and .erg.info
+ * size and sub-second mtime) replaces parsing the .erg.info: the schema, layout and
+ * Time index are read from one mapping. A missing or stale cache is
+ * rewritten after a normal parse. erg->info is NULL when the cache is used.
+ *
+ * @param erg Pointer to initialized ERG structure
+ * @param options Mapping policy (NULL = defaults)
+ */
+void erg_parse_with_options(ERG* erg, const ERGOpenOptions* options);
+
+/**
+ * Start loading an ERG file in the background instead of memory-mapping it
+ * The .erg file is read with large aligned positional reads, queue_depth of
+ * them in flight, while the .erg.info file is parsed alongside, so I/O for
+ * many files can overlap with decoding. Completes into the same state as
+ * erg_parse(), except that the data lives in erg->read_buffer: open options,
+ * erg_refresh() and page release do not apply.
+ * Exits if the file cannot be opened or read
+ *
+ * @param erg Pointer to ERG structure initialized with erg_init()
+ * @param options Read options (NULL = defaults)
+ * @return Handle to pass to erg_open_poll() and erg_open_wait()
+ */
+ERGAsyncOpen* erg_open_async(ERG* erg, const ERGReadOptions* options);
+
+/**
+ * Check whether an asynchronous open has finished reading (non-blocking)
+ *
+ * @param op Handle from erg_open_async()
+ * @return 1 if erg_open_wait() will not block, 0 otherwise
+ */
+int erg_open_poll(ERGAsyncOpen* op);
+
+/**
+ * Wait for an asynchronous open to finish and complete the ERG structure
+ * Releases the handle; the ERG is then ready for use
+ *
+ * @param op Handle from erg_open_async()
+ */
+void erg_open_wait(ERGAsyncOpen* op);
+
+/**
+ * Pick up rows appended to the file since erg_parse() or the last refresh
+ * For results still being written by a running simulation: set
+ * erg->follow_mode = 1 before erg_parse() so a header-only file or a
+ * partial trailing row is accepted silently. Extends the mapping in place
+ * (mremap on Linux) and advances sample_count to the last complete row.
+ * The Time index is re-probed; a columnar buffer is rebuilt.
+ * Exits if the mapping cannot be extended
+ *
+ * @param erg Pointer to parsed ERG structure
+ * @return Number of new complete samples (0 if the file has not grown)
+ */
+size_t erg_refresh(ERG* erg);
+
+/**
+ * Convert the data region to a column-major buffer owned by the handle
+ * Runs a cache-blocked tiled transpose (AVX2 for 4- and 8-byte types) once;
+ * afterwards every extraction is a contiguous copy instead of a strided gather
+ * Uses as much memory as the data region; released by erg_free()
+ * Does nothing if already enabled
+ * Exits on allocation failure
+ *
+ * @param erg Pointer to parsed ERG structure
+ */
+void erg_enable_columnar(ERG* erg);
+
 /**
  * Get signal data by name (returns raw typed data with scaling applied)
  * Returns data in its native type (float*, double*, int*, etc.)
  * Applies scaling (factor/offset) in-place using native type if needed
+ * (integer types are scaled in double precision, then rounded and saturated;
+ * use erg_get_signal_as_double() to keep fractional results)
  * Uses memory-mapped I/O for efficient zero-copy access
  * Allocates new array - caller must free
  *
@@ -112,6 +344,154 @@ void erg_parse(ERG* erg);
  */
 void* erg_get_signal(const ERG* erg, const char* signal_name);
 
+/**
+ * Get signal data by name converted to double with scaling applied
+ * Gathers, converts and applies factor/offset (FMA) in a single vectorized
+ * pass, for any numeric type. Allocates new array - caller must free
+ *
+ * @param erg Pointer to ERG structure
+ * @param signal_name Name of signal
+ * @return Newly allocated array of erg->sample_count doubles,
+ *         NULL if not found, empty or a raw byte signal
+ */
+double* erg_get_signal_as_double(const ERG* erg, const char* signal_name);
+
+/**
+ * Get signal data by name converted to float with scaling applied
+ * Scaling is computed in double precision and rounded once to float
+ *
+ * @param erg Pointer to ERG structure
+ * @param signal_name Name of signal
+ * @return Newly allocated array of erg->sample_count floats,
+ *         NULL if not found, empty or a raw byte signal
+ */
+float* erg_get_signal_as_float(const ERG* erg, const char* signal_name);
+
+/**
+ * Get signal data by name into a caller-provided buffer (no allocation)
+ * Same data and scaling as erg_get_signal()
+ *
+ * @param erg Pointer to ERG structure
+ * @param signal_name Name of signal
+ * @param dst Destination buffer
+ * @param dst_capacity Size of dst in bytes (at least sample_count * type_size)
+ * @return Number of samples written, 0 if not found or dst is too small
+ */
+size_t erg_get_signal_into(const ERG* erg, const char* signal_name, void* dst, size_t dst_capacity);
+
+/**
+ * Get signal data by index into a caller-provided buffer (no allocation)
+ * Same as erg_get_signal_into() but skips the name lookup
+ *
+ * @param erg Pointer to ERG structure
+ * @param index Index of signal (see erg_find_signal_index())
+ * @param dst Destination buffer
+ * @param dst_capacity Size of dst in bytes (at least sample_count * type_size)
+ * @return Number of samples written, 0 if index is invalid or dst is too small
+ */
+size_t erg_get_signal_into_by_index(const ERG* erg, size_t index, void* dst, size_t dst_capacity);
+
+/**
+ * Get a window of samples of one signal into a caller-provided buffer
+ * Only the rows inside the window are read, so the cost (and the pages
+ * faulted in) is proportional to count, not to the file size
+ * Same data and scaling as erg_get_signal()
+ *
+ * @param erg Pointer to ERG structure
+ * @param index Index of signal (see erg_find_signal_index())
+ * @param first_sample Index of the first sample to read
+ * @param count Number of samples to read (clamped to the end of the data)
+ * @param dst Destination buffer, at least count * type_size bytes
+ * @return Number of samples written, 0 if index or first_sample is out of range
+ */
+size_t erg_get_signal_range(const ERG* erg, size_t index, size_t first_sample, size_t count, void* dst);
+
+/**
+ * Get signal data by name, allocated from a caller-supplied arena
+ * The result lives until the arena is reset or freed - do not free() it
+ * Columns start on a 64-byte boundary; an arena created with
+ * arena_init_aligned(..., ARENA_ALIGN_CACHE_LINE) needs no padding for that
+ * Unscaled 4- and 8-byte columns of 8 MB or more are written with
+ * non-temporal stores (also by erg_get_signals_arena() and the other
+ * extraction calls), so they do not evict the rows being read
+ *
+ * @param erg Pointer to ERG structure
+ * @param signal_name Name of signal
+ * @param arena Arena to allocate the result from
+ * @return Pointer to typed array in the arena (64-byte aligned), NULL if not found
+ */
+void* erg_get_signal_arena(const ERG* erg, const char* signal_name, Arena* arena);
+
+/**
+ * Get several signals in a single pass over the data
+ * Rows are swept once in cache-sized blocks and every requested column is
+ * extracted (and scaled) from each block before moving on, so the cost is
+ * one streaming pass regardless of how many signals are requested
+ * Each output array is allocated separately - caller must free each one
+ *
+ * @param erg Pointer to ERG structure
+ * @param signal_names Array of signal names
+ * @param count Number of signals requested
+ * @param out Receives one array per requested signal (NULL if not found)
+ *            Layout and types are the same as for erg_get_signal()
+ * @return Number of signals found and extracted
+ */
+size_t erg_get_signals(const ERG* erg, const char* const* signal_names, size_t count, void** out);
+
+/**
+ * Get several signals by index in a single pass over the data
+ * Same as erg_get_signals() but skips the name lookups
+ *
+ * @param erg Pointer to ERG structure
+ * @param indices Array of signal indices (see erg_find_signal_index())
+ * @param count Number of signals requested
+ * @param out Receives one array per requested signal (NULL if index invalid)
+ * @return Number of signals found and extracted
+ */
+size_t erg_get_signals_by_index(const ERG* erg, const size_t* indices, size_t count, void** out);
+
+/**
+ * Get several signals by index in a single pass, allocated from an arena
+ * Same as erg_get_signals_by_index() but the outputs live in the arena,
+ * so a whole job's columns are released with one arena_reset()/arena_free()
+ * Every output is 64-byte aligned (see erg_get_signal_arena())
+ *
+ * @param erg Pointer to ERG structure
+ * @param indices Array of signal indices
+ * @param count Number of signals requested
+ * @param out Receives one array per requested signal (NULL if index invalid)
+ * @param arena Arena to allocate the results from
+ * @return Number of signals found and extracted
+ */
+size_t erg_get_signals_arena(const ERG* erg, const size_t* indices, size_t count, void** out, Arena* arena);
+
+/**
+ * Get signal data by name, extracting row ranges on several threads
+ * Same result as erg_get_signal(); each worker extracts and scales
+ * cache-sized blocks of rows, so throughput scales until memory bandwidth
+ * is saturated. Allocates new array - caller must free
+ *
+ * @param erg Pointer to ERG structure
+ * @param signal_name Name of signal
+ * @param thread_count Number of threads including the caller (0 = all processors)
+ * @return Pointer to newly allocated typed array, NULL if signal not found
+ */
+void* erg_get_signal_parallel(const ERG* erg, const char* signal_name, size_t thread_count);
+
+/**
+ * Extract several signals by index, extracting row ranges on several threads
+ * Same result as erg_get_signals_by_index(); caller frees each out[k]
+ *
+ * @param erg Pointer to ERG structure
+ * @param indices Signal indices
+ * @param count Number of signals requested
+ * @param out Receives count pointers (NULL for invalid indices)
+ * @param thread_count Number of threads including the caller (0 = all processors)
+ * @return Number of signals extracted
+ */
+size_t erg_get_signals_parallel(const ERG* erg, const size_t* indices, size_t count, void** out,
+                                size_t thread_count);
+
 /**
  * Get signal metadata by name
  *
@@ -123,6 +503,7 @@ const ERGSignal* erg_get_signal_info(const ERG* erg, const char* signal_name);
 
 /**
  * Get index of signal by name
+ * Constant time via the hash index built by erg_parse()
  *
  * @param erg Pointer to ERG structure
  * @param signal_name Name of signal
@@ -130,6 +511,168 @@ const ERGSignal* erg_get_signal_info(const ERG* erg, const char* signal_name);
  */
 int erg_find_signal_index(const ERG* erg, const char* signal_name);
 
+/**
+ * Decimate a window of one signal into min/max buckets for plotting
+ * Samples [first_sample, first_sample + count) are split evenly into
+ * bucket_count buckets; extrema are computed with SIMD straight from the
+ * mapped rows without extracting the column. NaN samples are ignored.
+ *
+ * @param erg Pointer to ERG structure
+ * @param index Index of signal (see erg_find_signal_index())
+ * @param first_sample First sample of the window
+ * @param count Number of samples in the window (clamped to the end of the data)
+ * @param bucket_count Number of buckets requested (e.g. the plot width in pixels)
+ * @param out Receives bucket_count buckets
+ * @return Number of buckets written (at most the number of samples),
+ *         0 if the signal is invalid or not numeric
+ */
+size_t erg_get_signal_minmax(const ERG* erg, size_t index, size_t first_sample, size_t count,
+                             size_t bucket_count, ERGBucket* out);
+
+/**
+ * Compute descriptive statistics for a set of signals in one sweep
+ * Rows are visited in tiles of a few thousand rows; within a tile, groups
+ * of selected columns are converted and scaled block by block into an
+ * L2-resident buffer and each column is reduced with SIMD once per tile,
+ * so no column is materialized and wide rows still give long reductions.
+ * Mean and variance are merged per tile (Chan et al.) for numerical
+ * stability.
+ *
+ * @param erg Pointer to ERG structure
+ * @param selection Signal indices (NULL = every signal, count is ignored)
+ * @param count Number of signal indices
+ * @param out Receives one entry per selected signal (signal_count entries
+ *            if selection is NULL); invalid or raw byte signals get count 0
+ * @return Number of signals with statistics
+ */
+size_t erg_compute_stats(const ERG* erg, const size_t* selection, size_t count, ERGStats* out);
+
+/**
+ * Open the LOD pyramid sidecar (<file>.erg.lod) for a parsed ERG file.
+ * erg_parse never builds the pyramid: it is built lazily here, so the
+ * first open of a file (or the first after it changed) pays one extra pass
+ * over the rows. A missing or stale sidecar (different size or sub-second
+ * mtime of the .erg or .erg.info) is rebuilt when build_if_stale is set,
+ * then memory-mapped; without it such an open fails. If the sidecar cannot
+ * be written the pyramid is kept in memory instead.
+ *
+ * @param lod Pyramid handle to initialize
+ * @param erg Pointer to parsed ERG structure
+ * @param build_if_stale 1 to (re)build a missing or stale sidecar
+ * @return 0 on success, -1 if no valid pyramid is available
+ */
+int erg_lod_open(ERGLod* lod, const ERG* erg, int build_if_stale);
+
+/**
+ * Decimate a window of one signal into min/max buckets using the pyramid
+ * Produces the same buckets as erg_get_signal_minmax() but reads only
+ * O(levels) pyramid entries plus unaligned edge samples per bucket
+ *
+ * @param lod Open pyramid for erg
+ * @param erg Pointer to the ERG structure the pyramid was opened for
+ * @param index Index of signal
+ * @param first_sample First sample of the window
+ * @param count Number of samples in the window (clamped to the end of the data)
+ * @param bucket_count Number of buckets requested
+ * @param out Receives bucket_count buckets
+ * @return Number of buckets written, 0 if the request or pyramid is invalid
+ */
+size_t erg_lod_query(const ERGLod* lod, const ERG* erg, size_t index, size_t first_sample,
+                     size_t count, size_t bucket_count, ERGBucket* out);
+
+/**
+ * Release a pyramid opened with erg_lod_open()
+ */
+void erg_lod_close(ERGLod* lod);
+
+/**
+ * Initialize an index over a non-decreasing column
+ * Reads only the first, last and a few probe samples
+ *
+ * @param index Index to initialize
+ * @param erg Pointer to parsed ERG structure
+ * @param signal_index Index of the key signal (see erg_find_signal_index())
+ * @return 0 on success, -1 if the signal is invalid, not numeric or empty
+ */
+int erg_key_index_init(ERGKeyIndex* index, const ERG* erg, size_t signal_index);
+
+/**
+ * Find the first sample whose key is >= key
+ *
+ * @param erg Pointer to ERG structure the index was built for
+ * @param index Key index (its lookup hint is updated)
+ * @param key Key value (scaled units)
+ * @return Sample position in [0, sample_count]
+ */
+size_t erg_key_index_lower_bound(const ERG* erg, ERGKeyIndex* index, double key);
+
+/**
+ * Find the samples whose key lies in [lo, hi]
+ *
+ * @param erg Pointer to ERG structure the index was built for
+ * @param index Key index (its lookup hint is updated)
+ * @param lo Lower key bound (inclusive)
+ * @param hi Upper key bound (inclusive)
+ * @param first Receives the first matching sample
+ * @return Number of matching samples (read them with erg_get_signal_range())
+ */
+size_t erg_key_index_range(const ERG* erg, ERGKeyIndex* index, double lo, double hi, size_t* first);
+
+/**
+ * Find the samples with Time in [t0, t1] using erg->time_index
+ *
+ * @param erg Pointer to parsed ERG structure
+ * @param t0 Start time (inclusive)
+ * @param t1 End time (inclusive)
+ * @param first Receives the first matching sample
+ * @return Number of matching samples, 0 if there is no Time signal
+ */
+size_t erg_find_time_range(ERG* erg, double t0, double t1, size_t* first);
+
+/**
+ * Start iterating over the rows of a parsed ERG file
+ * Selected signals are extracted per block into buffers owned by the
+ * iterator; without columns only row_data is provided.
+ * Exits on allocation failure or an invalid signal index
+ *
+ * @param it Iterator to initialize
+ * @param erg Pointer to parsed ERG structure (must outlive the iterator)
+ * @param block_rows Rows per block (0 = as many as fit in 256 KB)
+ * @param columns Signal indices to extract per block (may be NULL)
+ * @param column_count Number of signal indices
+ * @param flags Combination of ERG_ITER_DROP_BEHIND and ERG_ITER_WINDOW
+ */
+void erg_iter_init(ERGIterator* it, const ERG* erg, size_t block_rows,
+                   const size_t* columns, size_t column_count, int flags);
+
+/**
+ * Advance to the next block of rows
+ * Afterwards it->row_data points at it->rows rows starting at it->first_row
+ * and it->column_data[k] holds it->rows samples of columns[k].
+ * Both stay valid until the next call.
+ *
+ * @param it Iterator
+ * @return Number of rows in the block, 0 at the end of the data
+ */
+size_t erg_iter_next(ERGIterator* it);
+
+/**
+ * Release the buffers and mapping held by an iterator
+ */
+void erg_iter_free(ERGIterator* it);
+
+/**
+ * Get statistics of one signal stored in the .erg.idx cache
+ * Available when the file was opened with use_index and the cache was
+ * written with index_stats (see ERGOpenOptions)
+ *
+ * @param erg Pointer to parsed ERG structure
+ * @param index Index of signal
+ * @param out Receives the statistics
+ * @return 0 on success, -1 if no cached statistics are available
+ */
+int erg_get_cached_stats(const ERG* erg, size_t index, ERGStats* out);
+
 /**
  * Free all memory associated with ERG structure
  */
@@ -2,6 +2,7 @@
 #define INFOFILE_H
 
 #include <stddef.h>
+#include <stdint.h>
 #include <arena.h>
 
 /**
@@ -15,12 +16,26 @@ typedef struct {
 
 /**
  * Represents a key-value pair
+ * Strings are NUL-terminated except for views into a mapped file
+ * (see infofile_map_file); the lengths are valid in both cases.
  */
 typedef struct {
-    const char *key;    /* Points into key_arena */
-    const char *value;  /* Points into value_arena */
+    const char *key;     /* Points into key_arena or the mapped file */
+    const char *value;   /* Points into value_arena or the mapped file */
+    uint32_t key_len;    /* Key length in bytes */
+    uint32_t value_len;  /* Value length in bytes */
 } InfoFileEntry;
 
+/**
+ * Slot of the open-addressing key index
+ * Hash and key length are cached so most probes never touch the key bytes
+ */
+typedef struct {
+    uint32_t hash;      /* FNV-1a hash of the key */
+    uint32_t key_len;   /* Key length in bytes */
+    uint32_t index;     /* Entry index + 1 (0 = empty slot) */
+} InfoFileSlot;
+
 /**
  * Represents a parsed info file
  * Uses zero-copy parsing, SIMD whitespace trimming,
@@ -31,8 +46,33 @@ typedef struct {
     size_t count;            /* Number of entries */
     size_t capacity;         /* Allocated capacity */
     DualArena arena;         /* Dual arena for keys/values */
+    InfoFileSlot *slots;     /* Key index (first occurrence of each key) */
+    size_t slot_mask;        /* Slot count - 1 (power of two) */
+    size_t slot_used;        /* Occupied slots */
+    uint32_t *sorted;        /* Entry indices in key order ('.' sorts first) */
+    size_t sorted_count;     /* Entries covered by the sorted index */
+    const char *mapped_data; /* File mapped by infofile_map_file, or NULL */
+    size_t mapped_size;      /* Size of the mapping in bytes */
 } InfoFile;
 
+/**
+ * Position in the sorted key index over a run of matching entries
+ */
+typedef struct {
+    const InfoFile *info;    /* File being enumerated */
+    size_t next;             /* Next position in info->sorted */
+    size_t end;              /* One past the last matching position */
+} InfoFileCursor;
+
+/**
+ * Direct child of a dotted key ("Car" below "Quantity")
+ */
+typedef struct {
+    const char *name;        /* Child segment, points into an entry key (not terminated) */
+    size_t name_len;         /* Segment length in bytes */
+    InfoFileCursor entries;  /* The child key itself and every key below it */
+} InfoFileChild;
+
 /**
  * Initialize an InfoFile structure
  */
@@ -44,17 +84,133 @@ void infofile_init(InfoFile *info);
  */
 void infofile_parse_file(const char *filename, InfoFile *info);
 
+/**
+ * Parse an info file by mapping it into memory (zero-copy)
+ * Keys and single-line values become (pointer, length) views into the
+ * mapping and are NOT NUL-terminated; read them through key_len/value_len
+ * or infofile_get_entry(). Multi-line values are joined into value_arena.
+ * The mapping lives until infofile_free(). At most one file per InfoFile.
+ * Exits on error with descriptive message
+ */
+void infofile_map_file(const char *filename, InfoFile *info);
+
 /**
  * Parse an info file from a string buffer
  * Exits on error with descriptive message
  */
 void infofile_parse_string(const char *data, size_t len, InfoFile *info);
 
+/**
+ * Parse an info file from a string buffer using several threads
+ * The buffer is split at lines that start an entry (never inside a
+ * multi-line value); chunks are parsed into thread-local arenas and
+ * appended in file order, so the result equals infofile_parse_string().
+ * Buffers under about 2 MB are parsed sequentially.
+ * Exits on error with descriptive message
+ *
+ * @param data Buffer holding the info file text
+ * @param len Buffer length in bytes
+ * @param info Initialized InfoFile receiving the entries
+ * @param thread_count Worker threads, 0 for one per CPU
+ */
+void infofile_parse_string_parallel(const char *data, size_t len, InfoFile *info,
+                                    size_t thread_count);
+
+/**
+ * Parse an info file from a file path using several threads
+ * See infofile_parse_string_parallel()
+ * Exits on error with descriptive message
+ */
+void infofile_parse_file_parallel(const char *filename, InfoFile *info, size_t thread_count);
+
 /**
  * Get a value by key (returns NULL if not found)
+ * O(1) through the hash index; the first occurrence of a duplicated key wins.
+ * Values from infofile_map_file are not terminated, use infofile_get_entry
  */
 const char *infofile_get(const InfoFile *info, const char *key);
 
+/**
+ * Get the entry for a key, with key and value lengths (returns NULL if not found)
+ */
+const InfoFileEntry *infofile_get_entry(const InfoFile *info, const char *key);
+
+/**
+ * Find all entries whose key starts with a prefix
+ * Binary search over the sorted key index built during parsing; entries are
+ * returned in key order with '.' sorting before any other character, so a
+ * key is followed directly by its subtree
+ *
+ * @param info Parsed info file
+ * @param prefix Key prefix (e.g. "Quantity.Car."); "" matches every entry
+ * @param cursor Receives the matching range, walk it with infofile_cursor_next()
+ * @return Number of matching entries (duplicated keys included)
+ */
+size_t infofile_get_prefix(const InfoFile *info, const char *prefix, InfoFileCursor *cursor);
+
+/**
+ * Advance a cursor
+ *
+ * @param cursor Cursor from infofile_get_prefix() or an InfoFileChild
+ * @return Next entry, or NULL when the range is exhausted
+ */
+const InfoFileEntry *infofile_cursor_next(InfoFileCursor *cursor);
+
+/**
+ * Enumerate the distinct children directly below a dotted parent key
+ * For "Quantity" with keys Quantity.Car.v.Unit and Quantity.Time.Unit the
+ * children are "Car" and "Time". Children come out in key order.
+ *
+ * @param info Parsed info file
+ * @param parent Parent key without trailing dot; NULL or "" for top-level names
+ * @param children Output array (may be NULL when max is 0)
+ * @param max Capacity of children
+ * @return Total number of children, which may exceed max
+ */
+size_t infofile_get_children(const InfoFile *info, const char *parent,
+                             InfoFileChild *children, size_t max);
+
+/**
+ * Convert a decimal number exactly (no locale dependence for '.')
+ * Plain decimals up to 19 significant digits with small exponents take an
+ * exact fast path; anything else (long mantissas, inf, nan, hex) uses strtod.
+ * The whole range must be the number, without surrounding whitespace.
+ *
+ * @param str Number text (need not be NUL-terminated)
+ * @param len Length of the text in bytes
+ * @param out Receives the value
+ * @return 0 on success, -1 if the text is not a number
+ */
+int infofile_parse_double(const char *str, size_t len, double *out);
+
+/**
+ * Get a value as a double
+ *
+ * @return 0 on success, -1 if the key is missing or not a number
+ */
+int infofile_get_double(const InfoFile *info, const char *key, double *out);
+
+/**
+ * Get a value as a decimal 64-bit integer
+ *
+ * @return 0 on success, -1 if the key is missing, not an integer or out of range
+ */
+int infofile_get_int(const InfoFile *info, const char *key, int64_t *out);
+
+/**
+ * Parse a whitespace separated numeric value (e.g. a multi-line table)
+ * Tokens are split with SIMD and converted with infofile_parse_double().
+ *
+ * @param info Parsed info file (its value arena backs out == NULL)
+ * @param key Key of the table
+ * @param out Destination array, or NULL to allocate exactly from the value arena (32-byte aligned)
+ * @param count In: capacity of out (ignored when out is NULL);
+ *              out: number of values in the table, which may exceed the capacity,
+ *              or the index of the first bad token on failure
+ * @return out or the arena array, NULL if the key is missing or a token is not a number
+ */
+double *infofile_get_double_array(InfoFile *info, const char *key, double *out, size_t *count);
+
 /**
  * Free all memory associated with an InfoFile structure
  */
@@ -0,0 +1,71 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Minimal cross-platform fork-join helper (pthreads / Win32 threads)
+ *
+ * Work is expressed as task_count independent tasks; worker threads pull
+ * task numbers from a shared counter so uneven tasks balance themselves.
+ * The calling thread takes part in the work, so thread_count 1 runs
+ * everything inline without creating threads.
+ */
+
+/* Task callback: process task number `task` */
+typedef void (*ParallelTask)(void* context, size_t task);
+
+/**
+ * Number of online processors (at least 1)
+ */
+size_t parallel_default_threads(void);
+
+/**
+ * Run fn(context, t) for every t in [0, task_count) and wait for completion
+ * Falls back to running inline if threads cannot be created
+ *
+ * @param task_count Number of tasks
+ * @param thread_count Number of threads including the caller (0 = parallel_default_threads())
+ * @param fn Task callback (must be safe to call concurrently)
+ * @param context Passed to every call of fn
+ */
+void parallel_for(size_t task_count, size_t thread_count, ParallelTask fn, void* context);
+
+/* Opaque handle of tasks running in the background */
+typedef struct ParallelGroup ParallelGroup;
+
+/**
+ * Start running fn(context, t) for every t in [0, task_count) on background
+ * threads and return immediately; the caller does not take part.
+ * Runs the tasks inline (and returns a finished group) if no thread can be created.
+ * Exits on allocation failure
+ *
+ * @param task_count Number of tasks
+ * @param thread_count Number of worker threads (0 = parallel_default_threads())
+ * @param fn Task callback (must be safe to call concurrently)
+ * @param context Passed to every call of fn (must outlive the group)
+ * @return Group handle, release with parallel_wait()
+ */
+ParallelGroup* parallel_start(size_t task_count, size_t thread_count, ParallelTask fn, void* context);
+
+/**
+ * Check whether every task of a group has finished (non-blocking)
+ *
+ * @return 1 if all tasks have finished, 0 otherwise
+ */
+int parallel_poll(ParallelGroup* group);
+
+/**
+ * Wait for every task of a group to finish, then release the group
+ */
+void parallel_wait(ParallelGroup* group);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PARALLEL_H */
@@ -4,14 +4,15 @@
 #include <stddef.h>
 
 /**
- * SIMD-optimized string operations using AVX2
+ * SIMD-optimized string operations
  * These provide faster alternatives to standard C library functions
- * for use in performance-critical code paths
+ * for use in performance-critical code paths. Each call runs the
+ * scalar, SSE4.2, AVX2 or AVX-512 variant selected by cpu_simd_level().
  */
 
 /**
  * SIMD-optimized strlen
- * Processes 32 bytes at a time using AVX2
+ * Processes one aligned register (16/32/64 bytes) at a time
  *
  * @param str The string to measure
  * @return Length of the string (not including null terminator)
@@ -20,7 +21,7 @@ size_t strlen_simd(const char *str);
 
 /**
  * SIMD-optimized memcpy (aligned)
- * Uses AVX2 for 32-byte chunks, with alignment optimization
+ * Uses register-width chunks, with alignment optimization
  * Best for destinations that are 32-byte aligned
  *
  * @param dest Destination buffer
@@ -32,7 +33,7 @@ void *memcpy_simd(void *dest, const void *src, size_t n);
 
 /**
  * SIMD-optimized memcpy (unaligned)
- * Uses AVX2 for 32-byte chunks without alignment requirements
+ * Uses register-width chunks without alignment requirements
  * Best for arena allocations which may not be aligned
  *
  * @param dest Destination buffer (can be unaligned)
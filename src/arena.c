@@ -1,20 +1,64 @@
 #include <arena.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <string_simd.h>
 
+#ifdef _WIN32
+#include <malloc.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
 /* Internal structure for arena chunks */
 typedef struct ArenaChunk {
     struct ArenaChunk* next;     /* Next chunk in chain */
     size_t             capacity; /* Total capacity of this chunk */
     size_t             used;     /* Bytes used in this chunk */
-    char               data[];   /* Flexible array member for actual data */
+    size_t             align;    /* Alignment of data, 0 = plain malloc block */
+    char*              data;     /* Start of the usable bytes (same block) */
 } ArenaChunk;
 
-/* Allocate a new chunk */
-static ArenaChunk* chunk_create(size_t capacity) {
-    ArenaChunk* chunk = (ArenaChunk*)malloc(sizeof(ArenaChunk) + capacity);
+static inline size_t round_up(size_t n, size_t align) {
+    return (n + align - 1) & ~(align - 1);
+}
+
+static size_t system_page_size(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (size_t)info.dwPageSize;
+#else
+    long size = sysconf(_SC_PAGESIZE);
+    return size > 0 ? (size_t)size : 4096;
+#endif
+}
+
+static void check_alignment(size_t align, const char* caller) {
+    if (align == 0 || (align & (align - 1)) != 0) {
+        fprintf(stderr, "FATAL: %s: alignment %zu is not a power of two\n", caller, align);
+        exit(1);
+    }
+}
+
+/* Allocate a new chunk. With align != 0 the header sits in front of the data
+ * in one aligned block, padded so data starts on the boundary. */
+static ArenaChunk* chunk_create(size_t capacity, size_t align) {
+    ArenaChunk* chunk;
+    size_t      header = sizeof(ArenaChunk);
+    if (align == 0) {
+        chunk = (ArenaChunk*)malloc(header + capacity);
+    } else {
+        header     = round_up(header, align);
+        size_t all = header + round_up(capacity, align);
+#ifdef _WIN32
+        chunk = (ArenaChunk*)_aligned_malloc(all, align);
+#else
+        chunk = (ArenaChunk*)aligned_alloc(align, all);
+#endif
+    }
     if (!chunk) {
         fprintf(stderr, "FATAL: Failed to allocate arena chunk of %zu bytes\n", capacity);
         exit(1);
@@ -22,13 +66,42 @@ static ArenaChunk* chunk_create(size_t capacity) {
     chunk->next     = NULL;
     chunk->capacity = capacity;
     chunk->used     = 0;
+    chunk->align    = align;
+    chunk->data     = (char*)chunk + header;
     return chunk;
 }
 
+static void chunk_destroy(ArenaChunk* chunk) {
+#ifdef _WIN32
+    if (chunk->align) {
+        _aligned_free(chunk);
+        return;
+    }
+#endif
+    free(chunk);
+}
+
+/* Capacity of a new chunk in this arena (a multiple of the chunk alignment) */
+static size_t chunk_capacity(const Arena* arena, size_t capacity) {
+    return arena->chunk_align ? round_up(capacity, arena->chunk_align) : capacity;
+}
+
 void arena_init(Arena* arena, size_t initial_size) {
-    arena->chunk_size = initial_size;
-    arena->first      = chunk_create(initial_size);
-    arena->current    = arena->first;
+    arena->chunk_size  = initial_size;
+    arena->chunk_align = 0;
+    arena->first       = chunk_create(initial_size, 0);
+    arena->current     = arena->first;
+}
+
+void arena_init_aligned(Arena* arena, size_t initial_size, size_t chunk_align) {
+    if (chunk_align == ARENA_ALIGN_PAGE) {
+        chunk_align = system_page_size();
+    }
+    check_alignment(chunk_align, "arena_init_aligned");
+    arena->chunk_align = chunk_align;
+    arena->chunk_size  = chunk_capacity(arena, initial_size);
+    arena->first       = chunk_create(arena->chunk_size, chunk_align);
+    arena->current     = arena->first;
 }
 
 void arena_reserve(Arena* arena, size_t total_needed) {
@@ -48,7 +121,7 @@ void arena_reserve(Arena* arena, size_t total_needed) {
             arena->chunk_size *= 2;
         }
 
-        ArenaChunk* new_chunk = chunk_create(chunk_size);
+        ArenaChunk* new_chunk = chunk_create(chunk_capacity(arena, chunk_size), arena->chunk_align);
 
         /* Add to end of chain */
         ArenaChunk* last = arena->first;
@@ -57,7 +130,7 @@ void arena_reserve(Arena* arena, size_t total_needed) {
         }
         last->next = new_chunk;
 
-        total_available += chunk_size;
+        total_available += new_chunk->capacity;
     }
 }
 
@@ -68,28 +141,40 @@ char* arena_alloc(Arena* arena, size_t size) {
         arena->current->used += size;
         return ptr;
     }
+    return arena_alloc_aligned(arena, size, 1);
+}
+
+/* Offset in chunk of the first align-byte boundary at or after chunk->used */
+static inline size_t aligned_offset(const ArenaChunk* chunk, size_t align) {
+    uintptr_t next = (uintptr_t)(chunk->data + chunk->used);
+    return chunk->used + (size_t)(round_up(next, align) - next);
+}
+
+char* arena_alloc_aligned(Arena* arena, size_t size, size_t align) {
+    check_alignment(align, "arena_alloc_aligned");
 
-    /* Try to find a chunk with enough space */
-    ArenaChunk* chunk = arena->current->next;
+    /* Try the current chunk, then the ones after it */
+    ArenaChunk* chunk = arena->current;
     while (chunk) {
-        if (chunk->capacity - chunk->used >= size) {
+        size_t offset = aligned_offset(chunk, align);
+        if (offset <= chunk->capacity && chunk->capacity - offset >= size) {
             arena->current = chunk;
-            char* ptr      = chunk->data + chunk->used;
-            chunk->used += size;
-            return ptr;
+            chunk->used    = offset + size;
+            return chunk->data + offset;
         }
         chunk = chunk->next;
     }
 
     /* No existing chunk has space - allocate a new one */
     size_t new_chunk_size = arena->chunk_size;
+    size_t padding        = align > arena->chunk_align ? align - 1 : 0;
 
     /* If requested size is larger than default chunk size, make chunk bigger */
-    if (size > new_chunk_size) {
-        new_chunk_size = size * 2; /* Give some headroom */
+    if (size + padding > new_chunk_size) {
+        new_chunk_size = (size + padding) * 2; /* Give some headroom */
     }
 
-    ArenaChunk* new_chunk = chunk_create(new_chunk_size);
+    ArenaChunk* new_chunk = chunk_create(chunk_capacity(arena, new_chunk_size), arena->chunk_align);
 
     /* Add to end of chain */
     ArenaChunk* last = arena->first;
@@ -104,10 +189,10 @@ char* arena_alloc(Arena* arena, size_t size) {
     }
 
     /* Allocate from new chunk */
+    size_t offset   = aligned_offset(new_chunk, align);
     arena->current  = new_chunk;
-    char* ptr       = new_chunk->data;
-    new_chunk->used = size;
-    return ptr;
+    new_chunk->used = offset + size;
+    return new_chunk->data + offset;
 }
 
 char* arena_strdup(Arena* arena, const char* str) {
@@ -149,12 +234,37 @@ void arena_free(Arena* arena) {
     ArenaChunk* chunk = arena->first;
     while (chunk) {
         ArenaChunk* next = chunk->next;
-        free(chunk);
+        chunk_destroy(chunk);
         chunk = next;
     }
-    arena->first      = NULL;
-    arena->current    = NULL;
-    arena->chunk_size = 0;
+    arena->first       = NULL;
+    arena->current     = NULL;
+    arena->chunk_size  = 0;
+    arena->chunk_align = 0;
+}
+
+void arena_merge(Arena* dst, Arena* src) {
+    if (!src->first)
+        return;
+
+    if (!dst->first) {
+        dst->first       = src->first;
+        dst->current     = src->current;
+        dst->chunk_size  = src->chunk_size;
+        dst->chunk_align = src->chunk_align;
+    } else {
+        /* Splice behind the last chunk; allocation keeps going from dst->current */
+        ArenaChunk* last = dst->first;
+        while (last->next) {
+            last = last->next;
+        }
+        last->next = src->first;
+    }
+
+    src->first       = NULL;
+    src->current     = NULL;
+    src->chunk_size  = 0;
+    src->chunk_align = 0;
 }
 
 size_t arena_get_used(const Arena* arena) {
@@ -0,0 +1,150 @@
+#include <cpu_dispatch.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <stdatomic.h>
+#endif
+
+/* Detected and active levels, -1 until first use */
+#ifdef _WIN32
+static volatile LONG detected_level = -1;
+static volatile LONG active_level   = -1;
+#define LOAD_LEVEL(v)     InterlockedCompareExchange(&(v), -1, -1)
+#define STORE_LEVEL(v, x) InterlockedExchange(&(v), (LONG)(x))
+#else
+static atomic_int detected_level = -1;
+static atomic_int active_level   = -1;
+#define LOAD_LEVEL(v)     atomic_load_explicit(&(v), memory_order_relaxed)
+#define STORE_LEVEL(v, x) atomic_store_explicit(&(v), (int)(x), memory_order_relaxed)
+#endif
+
+static const char* const level_names[CPU_SIMD_LEVELS] = {"scalar", "sse42", "avx2", "avx512"};
+
+/* ============================================================================
+ * CPUID
+ * ============================================================================ */
+
+static void cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4]) {
+#if defined(_MSC_VER)
+    int out[4];
+    __cpuidex(out, (int)leaf, (int)subleaf);
+    for (int i = 0; i < 4; i++)
+        regs[i] = (unsigned)out[i];
+#elif defined(__x86_64__) || defined(__i386__)
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#else
+    (void)leaf;
+    (void)subleaf;
+    regs[0] = regs[1] = regs[2] = regs[3] = 0;
+#endif
+}
+
+/* Register state the OS saves on context switch (XCR0) */
+static uint64_t os_saved_state(void) {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#elif defined(__x86_64__) || defined(__i386__)
+    uint32_t lo, hi;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t)hi << 32) | lo;
+#else
+    return 0;
+#endif
+}
+
+static CpuSimdLevel detect_level(void) {
+    unsigned regs[4];
+    cpuid(0, 0, regs);
+    unsigned max_leaf = regs[0];
+    if (max_leaf < 1)
+        return CPU_SIMD_SCALAR;
+
+    cpuid(1, 0, regs);
+    unsigned ecx1 = regs[2];
+    int sse42   = (ecx1 >> 20) & 1;
+    int popcnt  = (ecx1 >> 23) & 1;
+    int osxsave = (ecx1 >> 27) & 1;
+    int avx     = (ecx1 >> 28) & 1;
+    int fma     = (ecx1 >> 12) & 1;
+    if (!sse42 || !popcnt)
+        return CPU_SIMD_SCALAR;
+
+    /* YMM (and ZMM) registers are only usable if the OS saves them */
+    uint64_t xcr0 = osxsave ? os_saved_state() : 0;
+    if (!avx || (xcr0 & 0x6) != 0x6 || max_leaf < 7)
+        return CPU_SIMD_SSE42;
+
+    cpuid(7, 0, regs);
+    unsigned ebx7 = regs[1];
+    int avx2     = (ebx7 >> 5) & 1;
+    int bmi1     = (ebx7 >> 3) & 1;
+    int bmi2     = (ebx7 >> 8) & 1;
+    int avx512f  = (ebx7 >> 16) & 1;
+    int avx512dq = (ebx7 >> 17) & 1;
+    int avx512bw = (ebx7 >> 30) & 1;
+    int avx512vl = (ebx7 >> 31) & 1;
+    if (!avx2 || !fma || !bmi1 || !bmi2)
+        return CPU_SIMD_SSE42;
+
+    if (!avx512f || !avx512dq || !avx512bw || !avx512vl || (xcr0 & 0xE6) != 0xE6)
+        return CPU_SIMD_AVX2;
+    return CPU_SIMD_AVX512;
+}
+
+/* ============================================================================
+ * PUBLIC API
+ * ============================================================================ */
+
+CpuSimdLevel cpu_simd_detect(void) {
+    int level = LOAD_LEVEL(detected_level);
+    if (level < 0) {
+        level = (int)detect_level();
+        STORE_LEVEL(detected_level, level);
+    }
+    return (CpuSimdLevel)level;
+}
+
+CpuSimdLevel cpu_simd_level(void) {
+    int level = LOAD_LEVEL(active_level);
+    if (level >= 0)
+        return (CpuSimdLevel)level;
+
+    level                = (int)cpu_simd_detect();
+    const char* override = getenv("LIBERG_SIMD");
+    if (override) {
+        for (int i = 0; i < CPU_SIMD_LEVELS; i++) {
+            if (strcmp(override, level_names[i]) == 0 && i < level) {
+                level = i;
+                break;
+            }
+        }
+    }
+    STORE_LEVEL(active_level, level);
+    return (CpuSimdLevel)level;
+}
+
+CpuSimdLevel cpu_simd_set_level(CpuSimdLevel level) {
+    CpuSimdLevel supported = cpu_simd_detect();
+    if ((int)level < 0)
+        level = CPU_SIMD_SCALAR;
+    if (level > supported)
+        level = supported;
+    STORE_LEVEL(active_level, level);
+    return level;
+}
+
+const char* cpu_simd_level_name(CpuSimdLevel level) {
+    if ((int)level < 0 || level >= CPU_SIMD_LEVELS)
+        return "unknown";
+    return level_names[level];
+}
@@ -1,5 +1,13 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* mremap(), O_DIRECT */
+#endif
+
+#include <cpu_dispatch.h>
 #include <erg.h>
+#include <errno.h>
 #include <infofile.h>
+#include <math.h>
+#include <parallel.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -14,6 +22,7 @@
 
 /* Memory-mapped file support */
 #ifdef _WIN32
+#include <sys/stat.h>
 #include <windows.h>
 #else
 #include <fcntl.h>
@@ -71,10 +80,179 @@ static ERGDataType parse_data_type(const char* type_str, size_t* type_size) {
     return ERG_UNKNOWN;
 }
 
-/* Helper function to convert string to double */
+/* FNV-1a hash for the signal name index */
+static uint32_t hash_signal_name(const char* name) {
+    uint32_t hash = 2166136261u;
+    while (*name) {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/* Build the open-addressing name index (load factor <= 0.5) */
+static void build_signal_index(ERG* erg) {
+    size_t slot_count = 16;
+    while (slot_count < erg->signal_count * 2) {
+        slot_count *= 2;
+    }
+
+    erg->signal_slots = calloc(slot_count, sizeof(ERGSignalSlot));
+    if (!erg->signal_slots) {
+        fprintf(stderr, "FATAL: Failed to allocate signal index (%zu bytes)\n",
+                slot_count * sizeof(ERGSignalSlot));
+        exit(1);
+    }
+    erg->slot_mask = slot_count - 1;
+
+    for (size_t i = 0; i < erg->signal_count; i++) {
+        uint32_t hash = hash_signal_name(erg->signals[i].name);
+        size_t   slot = hash & erg->slot_mask;
+        while (erg->signal_slots[slot].index != 0) {
+            /* Duplicate names keep the first occurrence, like a linear scan */
+            const ERGSignalSlot* existing = &erg->signal_slots[slot];
+            if (existing->hash == hash &&
+                strcmp(erg->signals[existing->index - 1].name, erg->signals[i].name) == 0)
+                break;
+            slot = (slot + 1) & erg->slot_mask;
+        }
+        if (erg->signal_slots[slot].index == 0) {
+            erg->signal_slots[slot].hash  = hash;
+            erg->signal_slots[slot].index = (uint32_t)(i + 1);
+        }
+    }
+}
+
+/* Look up a signal by a name that is not NUL-terminated (e.g. inside a key) */
+static int find_signal_index_n(const ERG* erg, const char* name, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)name[i];
+        hash *= 16777619u;
+    }
+
+    size_t slot = hash & erg->slot_mask;
+    while (erg->signal_slots[slot].index != 0) {
+        const ERGSignalSlot* entry     = &erg->signal_slots[slot];
+        const char*          candidate = erg->signals[entry->index - 1].name;
+        if (entry->hash == hash && strncmp(candidate, name, len) == 0 && candidate[len] == '\0') {
+            return (int)(entry->index - 1);
+        }
+        slot = (slot + 1) & erg->slot_mask;
+    }
+    return -1;
+}
+
+/* File.At.N.* values collected by the schema scan (index N - 1) */
+typedef struct {
+    const char* name;
+    const char* type;
+} SchemaColumn;
+
+/* Quantity.<name>.<field> entry, resolved once the signals exist */
+enum { SCHEMA_UNIT, SCHEMA_FACTOR, SCHEMA_OFFSET };
+
+typedef struct {
+    const char* name;      /* Signal name inside the key (not terminated) */
+    size_t      name_len;
+    int         field;     /* SCHEMA_UNIT, SCHEMA_FACTOR or SCHEMA_OFFSET */
+    const char* value;
+} SchemaQuantity;
+
+/* ============================================================================
+ * MAPPING POLICY
+ * ============================================================================ */
+
+/* Drop resident pages of [from, to) file bytes from one mapping */
+static void release_mapped_pages(const uint8_t* base, size_t base_offset, size_t base_size,
+                                size_t from, size_t to) {
+    if (!base || to <= base_offset || from >= base_offset + base_size) {
+        return;
+    }
+    if (from < base_offset) {
+        from = base_offset;
+    }
+    if (to > base_offset + base_size) {
+        to = base_offset + base_size;
+    }
+#ifdef _WIN32
+    /* Unlocking pages that are not locked trims them from the working set */
+    VirtualUnlock((LPVOID)(base + (from - base_offset)), to - from);
+#else
+    madvise((void*)(base + (from - base_offset)), to - from, MADV_DONTNEED);
+#endif
+}
+
+/* Evict file bytes [from, to) from the page cache */
+static void evict_cached_pages(const ERG* erg, size_t from, size_t to) {
+#if !defined(_WIN32) && defined(POSIX_FADV_DONTNEED)
+    posix_fadvise(erg->file_descriptor, (off_t)from, (off_t)(to - from), POSIX_FADV_DONTNEED);
+#else
+    (void)erg;
+    (void)from;
+    (void)to;
+#endif
+}
+
+/* Apply open_options advice to the current mapping (after mapping or remapping) */
+static void apply_map_policy(const ERG* erg) {
+    const ERGOpenOptions* options = &erg->open_options;
+    if (!erg->mapped_data || erg->mapped_size <= erg->data_offset) {
+        return;
+    }
+
+#ifdef _WIN32
+    /* No access advice on Windows: populate and prefetch both become a prefetch */
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+    if (options->populate || options->prefetch) {
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = (uint8_t*)erg->mapped_data + erg->data_offset;
+        range.NumberOfBytes  = erg->mapped_size - erg->data_offset;
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+#else
+    (void)options;
+#endif
+#else
+    /* madvise needs a page-aligned start, so advice covers the whole mapping */
+    if (options->advice == ERG_ADVICE_SEQUENTIAL) {
+        madvise(erg->mapped_data, erg->mapped_size, MADV_SEQUENTIAL);
+    } else if (options->advice == ERG_ADVICE_RANDOM) {
+        madvise(erg->mapped_data, erg->mapped_size, MADV_RANDOM);
+    }
+#ifdef MADV_HUGEPAGE
+    if (options->huge_pages) {
+        madvise(erg->mapped_data, erg->mapped_size, MADV_HUGEPAGE);
+    }
+#endif
+    /* Without MAP_POPULATE, populate falls back to asynchronous readahead */
+#ifdef MAP_POPULATE
+    int prefetch = options->prefetch;
+#else
+    int prefetch = options->prefetch || options->populate;
+#endif
+    if (prefetch) {
+        madvise(erg->mapped_data, erg->mapped_size, MADV_WILLNEED);
+    }
+#endif
+}
+
+/* Release the data region after a full-column scan if open_options.drop_behind is set */
+static void drop_scanned_pages(const ERG* erg) {
+    if (!erg->open_options.drop_behind || erg->columnar_data || !erg->mapped_data || erg->read_buffer) {
+        return;
+    }
+    release_mapped_pages((const uint8_t*)erg->mapped_data, 0, erg->mapped_size, 0, erg->mapped_size);
+    evict_cached_pages(erg, 0, erg->mapped_size);
+}
+
+/* Helper function to convert string to double; atof covers trailing text */
 static double parse_double(const char* str) {
     if (!str)
         return 0.0;
+    double value;
+    if (infofile_parse_double(str, strlen(str), &value) == 0)
+        return value;
     return atof(str);
 }
 
@@ -107,7 +285,8 @@ void erg_init(ERG* erg, const char* erg_file_path) {
 #endif
 }
 
-void erg_parse(ERG* erg) {
+/* Parse the .erg.info file into signal metadata, row layout and name index */
+static void parse_signal_metadata(ERG* erg) {
     /* Build info file path (.erg.info) using arena */
     size_t info_path_len = strlen(erg->erg_path) + 6; /* +".info" */
     char*  info_path     = arena_alloc(&erg->metadata_arena, info_path_len);
@@ -118,8 +297,73 @@ void erg_parse(ERG* erg) {
     infofile_parse_file(info_path, erg->info);
     /* No need to free - arena will handle it */
 
+    /* One pass over the entries: File.ByteOrder, File.At.N.{Name,Type} and
+     * Quantity.<name>.{Unit,Factor,Offset} are picked out as they stream by.
+     * Signal N can only be part of the 1..count run if N <= entry count. */
+    const InfoFile* info       = erg->info;
+    const char*     byte_order = NULL;
+    SchemaColumn*   columns    = calloc(info->count + 1, sizeof(SchemaColumn));
+    SchemaQuantity* quantities = malloc((info->count + 1) * sizeof(SchemaQuantity));
+    size_t          quantity_count = 0;
+    if (!columns || !quantities) {
+        fprintf(stderr, "FATAL: Failed to allocate schema scan buffers (%zu entries)\n", info->count);
+        exit(1);
+    }
+
+    for (size_t e = 0; e < info->count; e++) {
+        const char* key   = info->entries[e].key;
+        const char* value = info->entries[e].value;
+
+        if (strncmp(key, "File.", 5) == 0) {
+            if (strcmp(key + 5, "ByteOrder") == 0) {
+                if (!byte_order)
+                    byte_order = value;
+                continue;
+            }
+            if (strncmp(key + 5, "At.", 3) != 0)
+                continue;
+
+            /* File.At.<N>.<field>, N without leading zeros */
+            const char* p = key + 8;
+            size_t      n = 0;
+            if (*p < '1' || *p > '9')
+                continue;
+            while (*p >= '0' && *p <= '9' && n <= info->count) {
+                n = n * 10 + (size_t)(*p++ - '0');
+            }
+            if (*p != '.' || n > info->count)
+                continue;
+            if (strcmp(p + 1, "Name") == 0) {
+                if (!columns[n - 1].name)
+                    columns[n - 1].name = value;
+            } else if (strcmp(p + 1, "Type") == 0) {
+                if (!columns[n - 1].type)
+                    columns[n - 1].type = value;
+            }
+        } else if (strncmp(key, "Quantity.", 9) == 0) {
+            /* Quantity.<name>.<field>: the name may itself contain dots */
+            const char* name  = key + 9;
+            const char* field = strrchr(name, '.');
+            if (!field || field == name)
+                continue;
+            int kind;
+            if (strcmp(field + 1, "Unit") == 0)
+                kind = SCHEMA_UNIT;
+            else if (strcmp(field + 1, "Factor") == 0)
+                kind = SCHEMA_FACTOR;
+            else if (strcmp(field + 1, "Offset") == 0)
+                kind = SCHEMA_OFFSET;
+            else
+                continue;
+            SchemaQuantity* q = &quantities[quantity_count++];
+            q->name           = name;
+            q->name_len       = (size_t)(field - name);
+            q->field          = kind;
+            q->value          = value;
+        }
+    }
+
     /* Get byte order - only support little-endian */
-    const char* byte_order = infofile_get(erg->info, "File.ByteOrder");
     if (!byte_order) {
         fprintf(stderr, "FATAL: File.ByteOrder not found in ERG info file\n");
         exit(1);
@@ -130,15 +374,9 @@ void erg_parse(ERG* erg) {
     }
     erg->little_endian = 1;
 
-    /* Parse signal metadata */
-    /* Count signals first */
+    /* Signals are File.At.1 .. File.At.N up to the first missing name */
     size_t signal_count = 0;
-    char   key_buffer[256];
-    while (1) {
-        snprintf(key_buffer, sizeof(key_buffer), "File.At.%zu.Name", signal_count + 1);
-        const char* name = infofile_get(erg->info, key_buffer);
-        if (!name)
-            break;
+    while (signal_count < info->count && columns[signal_count].name) {
         signal_count++;
     }
 
@@ -156,63 +394,62 @@ void erg_parse(ERG* erg) {
         exit(1);
     }
 
-    /* Parse each signal's metadata */
+    /* Names, types and row layout */
     erg->row_size = 0;
     for (size_t i = 0; i < signal_count; i++) {
         ERGSignal* sig = &erg->signals[i];
-
-        /* Get signal name - use arena */
-        snprintf(key_buffer, sizeof(key_buffer), "File.At.%zu.Name", i + 1);
-        const char* name = infofile_get(erg->info, key_buffer);
-        sig->name        = arena_strdup(&erg->metadata_arena, name);
-
-        /* Get data type */
-        snprintf(key_buffer, sizeof(key_buffer), "File.At.%zu.Type", i + 1);
-        const char* type_str = infofile_get(erg->info, key_buffer);
-        if (!type_str) {
-            fprintf(stderr, "FATAL: Data type not found for signal %s\n", name);
+        sig->name      = arena_strdup(&erg->metadata_arena, columns[i].name);
+        if (!columns[i].type) {
+            fprintf(stderr, "FATAL: Data type not found for signal %s\n", columns[i].name);
             exit(1);
         }
-        sig->type = parse_data_type(type_str, &sig->type_size);
-
-        /* Get unit - use arena */
-        snprintf(key_buffer, sizeof(key_buffer), "Quantity.%s.Unit", name);
-        const char* unit = infofile_get(erg->info, key_buffer);
-        if (unit) {
-            sig->unit = arena_strdup(&erg->metadata_arena, unit);
-        } else {
-            sig->unit = arena_strdup(&erg->metadata_arena, "");
-        }
-
-        /* Get scaling factor */
-        snprintf(key_buffer, sizeof(key_buffer), "Quantity.%s.Factor", name);
-        const char* factor_str = infofile_get(erg->info, key_buffer);
-        sig->factor            = factor_str ? parse_double(factor_str) : 1.0;
+        sig->type   = parse_data_type(columns[i].type, &sig->type_size);
+        sig->unit   = NULL;
+        sig->factor = 1.0;
+        sig->offset = 0.0;
 
-        /* Get scaling offset */
-        snprintf(key_buffer, sizeof(key_buffer), "Quantity.%s.Offset", name);
-        const char* offset_str = infofile_get(erg->info, key_buffer);
-        sig->offset            = offset_str ? parse_double(offset_str) : 0.0;
-
-        /* Accumulate row size */
+        /* Record position in the row and accumulate row size */
+        sig->row_offset = erg->row_size;
         erg->row_size += sig->type_size;
     }
 
-    /* Read binary ERG file */
-    FILE* fp = fopen(erg->erg_path, "rb");
-    if (!fp) {
-        fprintf(stderr, "FATAL: Failed to open ERG file '%s'\n", erg->erg_path);
-        exit(1);
+    build_signal_index(erg);
+
+    /* Attach Quantity.* entries through the name index. Walking them in
+     * reverse lets the first occurrence of a key win, as a linear lookup would. */
+    for (size_t q = quantity_count; q-- > 0;) {
+        int index = find_signal_index_n(erg, quantities[q].name, quantities[q].name_len);
+        if (index < 0)
+            continue;
+        ERGSignal* sig = &erg->signals[index];
+        switch (quantities[q].field) {
+        case SCHEMA_UNIT:
+            sig->unit = (char*)quantities[q].value;
+            break;
+        case SCHEMA_FACTOR:
+            sig->factor = parse_double(quantities[q].value);
+            break;
+        default:
+            sig->offset = parse_double(quantities[q].value);
+            break;
+        }
+    }
+
+    /* Units - use arena */
+    for (size_t i = 0; i < signal_count; i++) {
+        ERGSignal* sig = &erg->signals[i];
+        sig->unit      = arena_strdup(&erg->metadata_arena, sig->unit ? sig->unit : "");
     }
 
-    /* Get file size */
-    fseek(fp, 0, SEEK_END);
-    long file_size = ftell(fp);
-    fseek(fp, 0, SEEK_SET);
+    free(quantities);
+    free(columns);
+}
 
-    if (file_size <= ERG_HEADER_SIZE) {
-        fprintf(stderr, "FATAL: ERG file too small (%ld bytes)\n", file_size);
-        fclose(fp);
+/* Derive data offset, data size and sample count from the .erg file size */
+static void set_data_layout(ERG* erg, size_t file_size) {
+    /* A file still being written may hold only the header so far */
+    if (file_size < ERG_HEADER_SIZE || (file_size == ERG_HEADER_SIZE && !erg->follow_mode)) {
+        fprintf(stderr, "FATAL: ERG file too small (%zu bytes)\n", file_size);
         exit(1);
     }
 
@@ -225,12 +462,12 @@ void erg_parse(ERG* erg) {
     /* Bug fix #1: Check for zero row size */
     if (erg->row_size == 0) {
         fprintf(stderr, "FATAL: Invalid row size (0 bytes) - no signals or signal metadata error\n");
-        fclose(fp);
         exit(1);
     }
 
-    /* Bug fix #3: Validate data alignment */
-    if (erg->data_size % erg->row_size != 0) {
+    /* Bug fix #3: Validate data alignment
+     * (in follow mode a partial trailing row is expected and ignored) */
+    if (erg->data_size % erg->row_size != 0 && !erg->follow_mode) {
         fprintf(stderr, "WARNING: Data size (%zu) not evenly divisible by row size (%zu)\n",
                 erg->data_size, erg->row_size);
         fprintf(stderr, "         File may be corrupt or truncated (remainder: %zu bytes)\n",
@@ -238,17 +475,59 @@ void erg_parse(ERG* erg) {
     }
 
     erg->sample_count = erg->data_size / erg->row_size;
+}
+
+/* Index the Time column (a few probes, no full scan) */
+static void index_time_column(ERG* erg) {
+    int time_signal = erg_find_signal_index(erg, "Time");
+    if (time_signal >= 0) {
+        erg_key_index_init(&erg->time_index, erg, (size_t)time_signal);
+    }
+}
 
-    /* Close the FILE* - we'll use memory mapping instead */
-    fclose(fp);
+/* Schema cache sidecar (see OPEN INDEX SIDECAR) */
+static int  index_load(ERG* erg);
+static void index_write(ERG* erg);
+
+void erg_parse(ERG* erg) {
+    /* A current .erg.idx replaces the .erg.info parse and the size probe */
+    int    use_index = erg->open_options.use_index && !erg->follow_mode;
+    int    indexed   = use_index && index_load(erg) == 0;
+    size_t file_size = erg->data_offset + erg->data_size;
+
+    if (!indexed) {
+        parse_signal_metadata(erg);
+
+        /* Read binary ERG file */
+        FILE* fp = fopen(erg->erg_path, "rb");
+        if (!fp) {
+            fprintf(stderr, "FATAL: Failed to open ERG file '%s'\n", erg->erg_path);
+            exit(1);
+        }
+
+        /* Get file size */
+        fseek(fp, 0, SEEK_END);
+        long length = ftell(fp);
+
+        /* Close the FILE* - we'll use memory mapping instead */
+        fclose(fp);
+
+        if (length < 0) {
+            fprintf(stderr, "FATAL: Failed to get size of ERG file '%s'\n", erg->erg_path);
+            exit(1);
+        }
+        file_size = (size_t)length;
+        set_data_layout(erg, file_size);
+    }
 
     /* Create memory-mapped file for efficient access */
 #ifdef _WIN32
     /* Windows memory mapping */
+    /* Let a running simulation keep writing the file in follow mode */
     erg->file_handle = CreateFileA(
         erg->erg_path,
         GENERIC_READ,
-        FILE_SHARE_READ,
+        erg->follow_mode ? (FILE_SHARE_READ | FILE_SHARE_WRITE) : FILE_SHARE_READ,
         NULL,
         OPEN_EXISTING,
         FILE_ATTRIBUTE_NORMAL,
@@ -260,7 +539,7 @@ void erg_parse(ERG* erg) {
         exit(1);
     }
 
-    erg->mapped_size = (size_t)file_size;
+    erg->mapped_size = file_size;
 
     erg->mapping_handle = CreateFileMappingA(
         erg->file_handle,
@@ -300,13 +579,20 @@ void erg_parse(ERG* erg) {
         exit(1);
     }
 
-    erg->mapped_size = (size_t)file_size;
+    erg->mapped_size = file_size;
+
+    int map_flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    if (erg->open_options.populate) {
+        map_flags |= MAP_POPULATE;
+    }
+#endif
 
     erg->mapped_data = mmap(
         NULL,
         erg->mapped_size,
         PROT_READ,
-        MAP_PRIVATE,
+        map_flags,
         erg->file_descriptor,
         0
     );
@@ -318,13 +604,36 @@ void erg_parse(ERG* erg) {
     }
 #endif
 
+    apply_map_policy(erg);
+    if (!indexed) {
+        index_time_column(erg);
+        if (use_index) {
+            index_write(erg);
+        }
+    }
+}
+
+void erg_parse_with_options(ERG* erg, const ERGOpenOptions* options) {
+    if (options) {
+        erg->open_options = *options;
+    } else {
+        memset(&erg->open_options, 0, sizeof(erg->open_options));
+    }
+    erg_parse(erg);
 }
 
 int erg_find_signal_index(const ERG* erg, const char* signal_name) {
-    for (size_t i = 0; i < erg->signal_count; i++) {
-        if (strcmp(erg->signals[i].name, signal_name) == 0) {
-            return (int)i;
+    if (!erg->signal_slots)
+        return -1;
+
+    uint32_t hash = hash_signal_name(signal_name);
+    size_t   slot = hash & erg->slot_mask;
+    while (erg->signal_slots[slot].index != 0) {
+        const ERGSignalSlot* entry = &erg->signal_slots[slot];
+        if (entry->hash == hash && strcmp(erg->signals[entry->index - 1].name, signal_name) == 0) {
+            return (int)(entry->index - 1);
         }
+        slot = (slot + 1) & erg->slot_mask;
     }
     return -1;
 }
@@ -340,6 +649,25 @@ const ERGSignal* erg_get_signal_info(const ERG* erg, const char* signal_name) {
  * SIGNAL SCALING
  * ============================================================================ */
 
+/* Largest doubles that convert to 64-bit integers without overflow */
+#define INT64_MIN_AS_DOUBLE  (-9223372036854775808.0)
+#define INT64_MAX_AS_DOUBLE  9223372036854774784.0
+#define UINT64_MAX_AS_DOUBLE 18446744073709549568.0
+
+/* Scale an integer sample in double precision, then round to nearest and
+ * saturate to [lo, hi]. Casting factor/offset to the integer type instead
+ * would turn a factor of 0.01 into 0. */
+static double scale_integer(double value, const ERGSignal* sig, double lo, double hi) {
+    double scaled = round(fma(value, sig->factor, sig->offset));
+    if (!(scaled >= lo)) {
+        return lo; /* Also catches NaN from a NaN factor */
+    }
+    if (scaled > hi) {
+        return hi;
+    }
+    return scaled;
+}
+
 /* Apply scaling to signal data in-place */
 static void apply_signal_scaling(void* data, const ERGSignal* sig, size_t sample_count) {
     if (sig->factor == 1.0 && sig->offset == 0.0) {
@@ -365,73 +693,57 @@ static void apply_signal_scaling(void* data, const ERGSignal* sig, size_t sample
     }
     case ERG_INT: {
         int32_t* idata = (int32_t*)data;
-        int32_t factor_i = (int32_t)sig->factor;
-        int32_t offset_i = (int32_t)sig->offset;
         for (size_t i = 0; i < sample_count; i++) {
-            idata[i] = idata[i] * factor_i + offset_i;
+            idata[i] = (int32_t)scale_integer(idata[i], sig, INT32_MIN, INT32_MAX);
         }
         break;
     }
     case ERG_UINT: {
         uint32_t* udata = (uint32_t*)data;
-        uint32_t factor_u = (uint32_t)sig->factor;
-        uint32_t offset_u = (uint32_t)sig->offset;
         for (size_t i = 0; i < sample_count; i++) {
-            udata[i] = udata[i] * factor_u + offset_u;
+            udata[i] = (uint32_t)scale_integer(udata[i], sig, 0.0, UINT32_MAX);
         }
         break;
     }
     case ERG_SHORT: {
         int16_t* sdata = (int16_t*)data;
-        int16_t factor_s = (int16_t)sig->factor;
-        int16_t offset_s = (int16_t)sig->offset;
         for (size_t i = 0; i < sample_count; i++) {
-            sdata[i] = sdata[i] * factor_s + offset_s;
+            sdata[i] = (int16_t)scale_integer(sdata[i], sig, INT16_MIN, INT16_MAX);
         }
         break;
     }
     case ERG_USHORT: {
         uint16_t* usdata = (uint16_t*)data;
-        uint16_t factor_us = (uint16_t)sig->factor;
-        uint16_t offset_us = (uint16_t)sig->offset;
         for (size_t i = 0; i < sample_count; i++) {
-            usdata[i] = usdata[i] * factor_us + offset_us;
+            usdata[i] = (uint16_t)scale_integer(usdata[i], sig, 0.0, UINT16_MAX);
         }
         break;
     }
     case ERG_LONGLONG: {
         int64_t* lldata = (int64_t*)data;
-        int64_t factor_ll = (int64_t)sig->factor;
-        int64_t offset_ll = (int64_t)sig->offset;
         for (size_t i = 0; i < sample_count; i++) {
-            lldata[i] = lldata[i] * factor_ll + offset_ll;
+            lldata[i] = (int64_t)scale_integer((double)lldata[i], sig, INT64_MIN_AS_DOUBLE, INT64_MAX_AS_DOUBLE);
         }
         break;
     }
     case ERG_ULONGLONG: {
         uint64_t* ulldata = (uint64_t*)data;
-        uint64_t factor_ull = (uint64_t)sig->factor;
-        uint64_t offset_ull = (uint64_t)sig->offset;
         for (size_t i = 0; i < sample_count; i++) {
-            ulldata[i] = ulldata[i] * factor_ull + offset_ull;
+            ulldata[i] = (uint64_t)scale_integer((double)ulldata[i], sig, 0.0, UINT64_MAX_AS_DOUBLE);
         }
         break;
     }
     case ERG_CHAR: {
         int8_t* cdata = (int8_t*)data;
-        int8_t factor_c = (int8_t)sig->factor;
-        int8_t offset_c = (int8_t)sig->offset;
         for (size_t i = 0; i < sample_count; i++) {
-            cdata[i] = cdata[i] * factor_c + offset_c;
+            cdata[i] = (int8_t)scale_integer(cdata[i], sig, INT8_MIN, INT8_MAX);
         }
         break;
     }
     case ERG_UCHAR: {
         uint8_t* ucdata = (uint8_t*)data;
-        uint8_t factor_uc = (uint8_t)sig->factor;
-        uint8_t offset_uc = (uint8_t)sig->offset;
         for (size_t i = 0; i < sample_count; i++) {
-            ucdata[i] = ucdata[i] * factor_uc + offset_uc;
+            ucdata[i] = (uint8_t)scale_integer(ucdata[i], sig, 0.0, UINT8_MAX);
         }
         break;
     }
@@ -442,93 +754,2980 @@ static void apply_signal_scaling(void* data, const ERGSignal* sig, size_t sample
     }
 }
 
+/* Convert one raw little-endian sample to double (no scaling) */
+static double raw_to_double(const uint8_t* p, ERGDataType type) {
+    switch (type) {
+    case ERG_FLOAT: {
+        float v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    case ERG_DOUBLE: {
+        double v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    case ERG_LONGLONG: {
+        int64_t v;
+        memcpy(&v, p, sizeof(v));
+        return (double)v;
+    }
+    case ERG_ULONGLONG: {
+        uint64_t v;
+        memcpy(&v, p, sizeof(v));
+        return (double)v;
+    }
+    case ERG_INT: {
+        int32_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    case ERG_UINT: {
+        uint32_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    case ERG_SHORT: {
+        int16_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    case ERG_USHORT: {
+        uint16_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    case ERG_CHAR:
+        return (int8_t)*p;
+    case ERG_UCHAR:
+        return *p;
+    case ERG_BYTES:
+    default:
+        return 0.0;
+    }
+}
+
 /* ============================================================================
- * PUBLIC API
+ * SIGNAL EXTRACTION
  * ============================================================================ */
 
-void* erg_get_signal(const ERG* erg, const char* signal_name) {
-    int index = erg_find_signal_index(erg, signal_name);
-    if (index < 0) {
-        return NULL;
+/* Target working set for one block of rows in batch extraction.
+ * Sized to stay resident in L2 while every requested column is copied out. */
+#define ERG_BLOCK_BYTES (256 * 1024)
+
+/* ============================================================================
+ * STRIDED GATHER KERNELS
+ * Copy one column out of row-major data. One kernel per type size so the
+ * element size is a compile-time constant; the kernel is chosen once per
+ * signal with select_extract_kernel(). 4- and 8-byte columns also have
+ * AVX2 and AVX-512 gather variants, picked from cpu_simd_level(), with
+ * non-temporal stores when the whole output column is large. That choice
+ * is made per column, so blocked and parallel sweeps stream as well.
+ * ============================================================================ */
+
+typedef void (*ExtractKernel)(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows);
+
+/* Gather indices are 32-bit, so the AVX2 paths need 8 rows (AVX-512: 16)
+ * to fit in INT32_MAX */
+#define GATHER_MAX_ROW_SIZE    ((size_t)INT32_MAX / 8)
+#define GATHER512_MAX_ROW_SIZE ((size_t)INT32_MAX / 16)
+
+/* Columns at least this large are written with non-temporal stores: they
+ * would not stay in cache anyway and only evict the rows being read */
+#define ERG_STREAM_MIN_BYTES ((size_t)8 * 1024 * 1024)
+
+/* Leading rows to copy with scalar code before dest reaches an align-byte
+ * boundary, or rows + 1 if the block is not streamed (regular stores) */
+static size_t stream_prologue(const uint8_t* dest, size_t type_size, size_t rows, size_t align, int stream) {
+    if (!stream || (uintptr_t)dest % type_size != 0) {
+        return rows + 1;
     }
+    size_t head = ((align - ((uintptr_t)dest & (align - 1))) & (align - 1)) / type_size;
+    return head < rows ? head : rows;
+}
 
-    /* Handle empty data case */
-    if (erg->sample_count == 0) {
-        return NULL;
+static void extract_rows_1(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    size_t i = 0;
+    for (; i + 4 <= rows; i += 4) {
+        dest[i + 0] = src[(i + 0) * row_size];
+        dest[i + 1] = src[(i + 1) * row_size];
+        dest[i + 2] = src[(i + 2) * row_size];
+        dest[i + 3] = src[(i + 3) * row_size];
     }
+    for (; i < rows; i++) {
+        dest[i] = src[i * row_size];
+    }
+}
 
-    /* Calculate offset to this signal's data in each row */
-    size_t offset = 0;
-    for (int i = 0; i < index; i++) {
-        offset += erg->signals[i].type_size;
+static void extract_rows_2(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    uint16_t v0, v1, v2, v3;
+    size_t   i = 0;
+    for (; i + 4 <= rows; i += 4) {
+        memcpy(&v0, src + (i + 0) * row_size, 2);
+        memcpy(&v1, src + (i + 1) * row_size, 2);
+        memcpy(&v2, src + (i + 2) * row_size, 2);
+        memcpy(&v3, src + (i + 3) * row_size, 2);
+        memcpy(dest + (i + 0) * 2, &v0, 2);
+        memcpy(dest + (i + 1) * 2, &v1, 2);
+        memcpy(dest + (i + 2) * 2, &v2, 2);
+        memcpy(dest + (i + 3) * 2, &v3, 2);
     }
+    for (; i < rows; i++) {
+        memcpy(&v0, src + i * row_size, 2);
+        memcpy(dest + i * 2, &v0, 2);
+    }
+}
 
-    const ERGSignal* sig = &erg->signals[index];
+static void extract_rows_4(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    uint32_t v;
+    for (size_t i = 0; i < rows; i++) {
+        memcpy(&v, src + i * row_size, 4);
+        memcpy(dest + i * 4, &v, 4);
+    }
+}
 
-    /* Allocate output array for signal data */
-    void* result = malloc(erg->sample_count * sig->type_size);
-    if (!result) {
-        fprintf(stderr, "FATAL: Failed to allocate signal array (%zu bytes)\n",
-                erg->sample_count * sig->type_size);
-        exit(1);
+static void extract_rows_8(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    uint64_t v;
+    for (size_t i = 0; i < rows; i++) {
+        memcpy(&v, src + i * row_size, 8);
+        memcpy(dest + i * 8, &v, 8);
     }
+}
 
-    /* Access data directly from memory-mapped file (zero-copy) */
-    if (!erg->mapped_data) {
-        fprintf(stderr, "FATAL: ERG file not memory-mapped\n");
-        free(result);
-        exit(1);
+CPU_TARGET_AVX2 static inline void gather_rows_4_avx2(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows,
+                                                      int stream) {
+    size_t i = 0;
+
+    /* AVX2 gather: 8 rows per instruction */
+    if (row_size <= GATHER_MAX_ROW_SIZE) {
+        __m256i index = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                           _mm256_set1_epi32((int)row_size));
+        size_t  head  = stream_prologue(dest, 4, rows, 32, stream);
+        int     nt    = head <= rows;
+        if (nt) {
+            extract_rows_4(dest, src, row_size, head);
+            i = head;
+        }
+        for (; i + 8 <= rows; i += 8) {
+            __m256i v = _mm256_i32gather_epi32((const int*)(src + i * row_size), index, 1);
+            if (nt) {
+                _mm256_stream_si256((__m256i*)(dest + i * 4), v);
+            } else {
+                _mm256_storeu_si256((__m256i*)(dest + i * 4), v);
+            }
+        }
+        if (nt) {
+            _mm_sfence();
+        }
     }
+    extract_rows_4(dest + i * 4, src + i * row_size, row_size, rows - i);
+}
 
-    /* Point to the start of the data region in the mapped file */
-    const uint8_t* row_data = (const uint8_t*)erg->mapped_data + erg->data_offset;
+CPU_TARGET_AVX2 static inline void gather_rows_8_avx2(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows,
+                                                      int stream) {
+    size_t i = 0;
+
+    /* AVX2 gather: 4 rows per instruction, two per iteration */
+    if (row_size <= GATHER_MAX_ROW_SIZE) {
+        __m128i index = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32((int)row_size));
+        size_t  head  = stream_prologue(dest, 8, rows, 32, stream);
+        int     nt    = head <= rows;
+        if (nt) {
+            extract_rows_8(dest, src, row_size, head);
+            i = head;
+        }
+        for (; i + 8 <= rows; i += 8) {
+            const uint8_t* p  = src + i * row_size;
+            __m256i        v0 = _mm256_i32gather_epi64((const long long*)p, index, 1);
+            __m256i        v1 = _mm256_i32gather_epi64((const long long*)(p + 4 * row_size), index, 1);
+            if (nt) {
+                _mm256_stream_si256((__m256i*)(dest + i * 8), v0);
+                _mm256_stream_si256((__m256i*)(dest + i * 8 + 32), v1);
+            } else {
+                _mm256_storeu_si256((__m256i*)(dest + i * 8), v0);
+                _mm256_storeu_si256((__m256i*)(dest + i * 8 + 32), v1);
+            }
+        }
+        if (nt) {
+            _mm_sfence();
+        }
+    }
+    extract_rows_8(dest + i * 8, src + i * row_size, row_size, rows - i);
+}
 
-    /* Extract signal data from row-major layout */
-    const uint8_t* src = row_data + offset;
-    uint8_t* dest = (uint8_t*)result;
-    for (size_t i = 0; i < erg->sample_count; i++) {
-        memcpy(dest + i * sig->type_size, src + i * erg->row_size, sig->type_size);
+CPU_TARGET_AVX512 static inline void gather_rows_4_avx512(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows,
+                                                          int stream) {
+    size_t i = 0;
+
+    /* AVX-512 gather: 16 rows per instruction */
+    if (row_size <= GATHER512_MAX_ROW_SIZE) {
+        __m512i index = _mm512_mullo_epi32(
+            _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+            _mm512_set1_epi32((int)row_size));
+        size_t head = stream_prologue(dest, 4, rows, 64, stream);
+        int    nt   = head <= rows;
+        if (nt) {
+            extract_rows_4(dest, src, row_size, head);
+            i = head;
+        }
+        for (; i + 16 <= rows; i += 16) {
+            __m512i v = _mm512_i32gather_epi32(index, (const void*)(src + i * row_size), 1);
+            if (nt) {
+                _mm512_stream_si512((void*)(dest + i * 4), v);
+            } else {
+                _mm512_storeu_si512((void*)(dest + i * 4), v);
+            }
+        }
+        if (nt) {
+            _mm_sfence();
+        }
     }
+    gather_rows_4_avx2(dest + i * 4, src + i * row_size, row_size, rows - i, 0);
+}
 
-    /* Apply scaling if needed */
-    apply_signal_scaling(result, sig, erg->sample_count);
+CPU_TARGET_AVX512 static inline void gather_rows_8_avx512(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows,
+                                                          int stream) {
+    size_t i = 0;
+
+    /* AVX-512 gather: 8 rows per instruction, two per iteration */
+    if (row_size <= GATHER512_MAX_ROW_SIZE) {
+        __m256i index = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                           _mm256_set1_epi32((int)row_size));
+        size_t head = stream_prologue(dest, 8, rows, 64, stream);
+        int    nt   = head <= rows;
+        if (nt) {
+            extract_rows_8(dest, src, row_size, head);
+            i = head;
+        }
+        for (; i + 16 <= rows; i += 16) {
+            const uint8_t* p  = src + i * row_size;
+            __m512i        v0 = _mm512_i32gather_epi64(index, (const void*)p, 1);
+            __m512i        v1 = _mm512_i32gather_epi64(index, (const void*)(p + 8 * row_size), 1);
+            if (nt) {
+                _mm512_stream_si512((void*)(dest + i * 8), v0);
+                _mm512_stream_si512((void*)(dest + i * 8 + 64), v1);
+            } else {
+                _mm512_storeu_si512((void*)(dest + i * 8), v0);
+                _mm512_storeu_si512((void*)(dest + i * 8 + 64), v1);
+            }
+        }
+        if (nt) {
+            _mm_sfence();
+        }
+    }
+    gather_rows_8_avx2(dest + i * 8, src + i * row_size, row_size, rows - i, 0);
+}
 
-    return result;
+/* Kernel entry points: regular stores, and non-temporal stores for columns
+ * of at least ERG_STREAM_MIN_BYTES (see select_extract_kernel()) */
+CPU_TARGET_AVX2 static void extract_rows_4_avx2(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    gather_rows_4_avx2(dest, src, row_size, rows, 0);
 }
 
-void erg_free(ERG* erg) {
-    if (!erg)
-        return;
+CPU_TARGET_AVX2 static void stream_rows_4_avx2(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    gather_rows_4_avx2(dest, src, row_size, rows, 1);
+}
 
-    /* Unmap memory-mapped file */
-    if (erg->mapped_data) {
-#ifdef _WIN32
-        UnmapViewOfFile(erg->mapped_data);
-        erg->mapped_data = NULL;
+CPU_TARGET_AVX2 static void extract_rows_8_avx2(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    gather_rows_8_avx2(dest, src, row_size, rows, 0);
+}
 
-        if (erg->mapping_handle) {
-            CloseHandle(erg->mapping_handle);
-            erg->mapping_handle = NULL;
-        }
+CPU_TARGET_AVX2 static void stream_rows_8_avx2(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    gather_rows_8_avx2(dest, src, row_size, rows, 1);
+}
 
-        if (erg->file_handle != INVALID_HANDLE_VALUE) {
-            CloseHandle(erg->file_handle);
-            erg->file_handle = INVALID_HANDLE_VALUE;
-        }
-#else
-        munmap(erg->mapped_data, erg->mapped_size);
-        erg->mapped_data = NULL;
+CPU_TARGET_AVX512 static void extract_rows_4_avx512(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    gather_rows_4_avx512(dest, src, row_size, rows, 0);
+}
 
-        if (erg->file_descriptor != -1) {
-            close(erg->file_descriptor);
-            erg->file_descriptor = -1;
-        }
-#endif
-        erg->mapped_size = 0;
+CPU_TARGET_AVX512 static void stream_rows_4_avx512(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    gather_rows_4_avx512(dest, src, row_size, rows, 1);
+}
+
+CPU_TARGET_AVX512 static void extract_rows_8_avx512(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    gather_rows_8_avx512(dest, src, row_size, rows, 0);
+}
+
+CPU_TARGET_AVX512 static void stream_rows_8_avx512(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    gather_rows_8_avx512(dest, src, row_size, rows, 1);
+}
+
+/* ERG_BYTES with an odd width (3, 5, 6 or 7 bytes) */
+static void extract_rows_3(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    for (size_t i = 0; i < rows; i++) {
+        memcpy(dest + i * 3, src + i * row_size, 3);
     }
+}
 
-    /* Free arena - this frees erg_path, all signal names, and all units in one call! */
-    arena_free(&erg->metadata_arena);
+static void extract_rows_5(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    for (size_t i = 0; i < rows; i++) {
+        memcpy(dest + i * 5, src + i * row_size, 5);
+    }
+}
+
+static void extract_rows_6(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    for (size_t i = 0; i < rows; i++) {
+        memcpy(dest + i * 6, src + i * row_size, 6);
+    }
+}
+
+static void extract_rows_7(uint8_t* dest, const uint8_t* src, size_t row_size, size_t rows) {
+    for (size_t i = 0; i < rows; i++) {
+        memcpy(dest + i * 7, src + i * row_size, 7);
+    }
+}
+
+/* Output size that decides streaming for a column of rows samples. Scaled
+ * signals are read straight back by apply_signal_scaling(), so they keep
+ * regular stores. */
+static size_t stream_column_bytes(const ERGSignal* sig, size_t rows) {
+    if (sig->factor != 1.0 || sig->offset != 0.0) {
+        return 0;
+    }
+    return rows * sig->type_size;
+}
+
+/* column_bytes is the size of the whole output column, even when it is
+ * filled block by block; 0 for scratch buffers that are read back at once */
+static ExtractKernel select_extract_kernel(size_t type_size, size_t column_bytes) {
+    static const ExtractKernel kernels[9] = {
+        NULL, extract_rows_1, extract_rows_2, extract_rows_3, extract_rows_4,
+        extract_rows_5, extract_rows_6, extract_rows_7, extract_rows_8,
+    };
+    if (type_size == 0 || type_size > 8) {
+        fprintf(stderr, "FATAL: Unsupported signal type size (%zu bytes)\n", type_size);
+        exit(1);
+    }
+
+    /* Gathers need AVX2; SSE4.2 has none and uses the scalar kernels */
+    CpuSimdLevel level  = cpu_simd_level();
+    int          stream = column_bytes >= ERG_STREAM_MIN_BYTES;
+    if (type_size == 4 && level >= CPU_SIMD_AVX512) {
+        return stream ? stream_rows_4_avx512 : extract_rows_4_avx512;
+    }
+    if (type_size == 4 && level >= CPU_SIMD_AVX2) {
+        return stream ? stream_rows_4_avx2 : extract_rows_4_avx2;
+    }
+    if (type_size == 8 && level >= CPU_SIMD_AVX512) {
+        return stream ? stream_rows_8_avx512 : extract_rows_8_avx512;
+    }
+    if (type_size == 8 && level >= CPU_SIMD_AVX2) {
+        return stream ? stream_rows_8_avx2 : extract_rows_8_avx2;
+    }
+    return kernels[type_size];
+}
+
+/* Point to the start of the data region in the mapped file */
+static const uint8_t* erg_row_data(const ERG* erg) {
+    if (!erg->mapped_data) {
+        fprintf(stderr, "FATAL: ERG file not memory-mapped\n");
+        exit(1);
+    }
+    return (const uint8_t*)erg->mapped_data + erg->data_offset;
+}
+
+/* Copy rows [first_row, first_row + rows) of one signal into dest.
+ * Reads a contiguous slice when the columnar buffer is available,
+ * otherwise gathers from the row-major mapping. */
+static void copy_signal_rows(const ERG* erg, const ERGSignal* sig, ExtractKernel kernel,
+                             size_t first_row, size_t rows, uint8_t* dest) {
+    if (erg->columnar_data) {
+        const uint8_t* column = (const uint8_t*)erg->columnar_data + sig->row_offset * erg->sample_count;
+        memcpy(dest, column + first_row * sig->type_size, rows * sig->type_size);
+        return;
+    }
+    const uint8_t* src = erg_row_data(erg) + first_row * erg->row_size + sig->row_offset;
+    kernel(dest, src, erg->row_size, rows);
+}
+
+/* Read one sample as a scaled double (row-major or columnar), rounded with
+ * fma() exactly like the erg_get_signal_as_double() kernels */
+static double read_sample_as_double(const ERG* erg, const ERGSignal* sig, size_t row) {
+    const uint8_t* p;
+    if (erg->columnar_data) {
+        p = (const uint8_t*)erg->columnar_data + sig->row_offset * erg->sample_count + row * sig->type_size;
+    } else {
+        p = erg_row_data(erg) + row * erg->row_size + sig->row_offset;
+    }
+    return fma(raw_to_double(p, sig->type), sig->factor, sig->offset);
+}
+
+/* Allocate output array for signal data */
+static void* alloc_signal_array(const ERG* erg, const ERGSignal* sig) {
+    void* result = malloc(erg->sample_count * sig->type_size);
+    if (!result) {
+        fprintf(stderr, "FATAL: Failed to allocate signal array (%zu bytes)\n",
+                erg->sample_count * sig->type_size);
+        exit(1);
+    }
+    return result;
+}
+
+/* ============================================================================
+ * FUSED CONVERT-AND-SCALE
+ * Gather one column, convert it to floating point and apply factor/offset
+ * with a single FMA per sample, in one pass. stride is the distance between
+ * samples: row_size for row-major data, type_size for a columnar slice.
+ * Vector and scalar paths round identically (fused multiply-add), so every
+ * SIMD level produces the same bits. There is no SSE4.2 gather: below AVX2
+ * the scalar kernel runs.
+ * ============================================================================ */
+
+static inline void store_scaled1(void* dest, size_t i, double v, int to_float) {
+    if (to_float) {
+        ((float*)dest)[i] = (float)v;
+    } else {
+        ((double*)dest)[i] = v;
+    }
+}
+
+/* Number of leading samples whose 4-byte gather stays inside the column:
+ * 1- and 2-byte types are gathered as 32-bit words, which over-reads the
+ * final samples by up to 3 bytes */
+static size_t gather_safe_rows(size_t type_size, size_t stride, size_t rows) {
+    if (type_size >= 4 || rows == 0) {
+        return rows;
+    }
+    size_t available = (rows - 1) * stride + type_size;
+    return available >= 4 ? (available - 4) / stride + 1 : 0;
+}
+
+/* Scalar kernel for samples [first, rows); also the tail of the vector kernels */
+static void convert_rows_scalar(const ERGSignal* sig, const uint8_t* src, size_t stride, size_t first,
+                                size_t rows, void* dest, int to_float) {
+    for (size_t i = first; i < rows; i++) {
+        store_scaled1(dest, i, fma(raw_to_double(src + i * stride, sig->type), sig->factor, sig->offset), to_float);
+    }
+}
+
+/* ---- AVX2: 4 doubles per vector ---- */
+
+CPU_TARGET_AVX2 static inline void store_scaled4(void* dest, size_t i, __m256d v, int to_float) {
+    if (to_float) {
+        _mm_storeu_ps((float*)dest + i, _mm256_cvtpd_ps(v));
+    } else {
+        _mm256_storeu_pd((double*)dest + i, v);
+    }
+}
+
+/* Widen 8 gathered 32-bit words holding a 1- or 2-byte sample in their low bytes */
+CPU_TARGET_AVX2 static inline __m256i widen_small_ints(__m256i v, ERGDataType type) {
+    switch (type) {
+    case ERG_SHORT:
+        return _mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16);
+    case ERG_USHORT:
+        return _mm256_and_si256(v, _mm256_set1_epi32(0xFFFF));
+    case ERG_CHAR:
+        return _mm256_srai_epi32(_mm256_slli_epi32(v, 24), 24);
+    case ERG_UCHAR:
+        return _mm256_and_si256(v, _mm256_set1_epi32(0xFF));
+    default:
+        return v;
+    }
+}
+
+/* Returns the number of leading samples converted */
+CPU_TARGET_AVX2 static size_t convert_rows_avx2(const ERGSignal* sig, const uint8_t* src, size_t stride,
+                                                size_t rows, void* dest, int to_float) {
+    __m256d factor = _mm256_set1_pd(sig->factor);
+    __m256d offset = _mm256_set1_pd(sig->offset);
+    size_t  i      = 0;
+
+    if (stride > GATHER_MAX_ROW_SIZE) {
+        return 0;
+    }
+    __m256i index8 = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                        _mm256_set1_epi32((int)stride));
+    __m128i index4 = _mm256_castsi256_si128(index8);
+
+    switch (sig->type) {
+    case ERG_DOUBLE:
+        for (; i + 4 <= rows; i += 4) {
+            __m256d v = _mm256_i32gather_pd((const double*)(src + i * stride), index4, 1);
+            store_scaled4(dest, i, _mm256_fmadd_pd(v, factor, offset), to_float);
+        }
+        break;
+    case ERG_FLOAT:
+        for (; i + 8 <= rows; i += 8) {
+            __m256  v  = _mm256_i32gather_ps((const float*)(src + i * stride), index8, 1);
+            __m256d lo = _mm256_cvtps_pd(_mm256_castps256_ps128(v));
+            __m256d hi = _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1));
+            store_scaled4(dest, i, _mm256_fmadd_pd(lo, factor, offset), to_float);
+            store_scaled4(dest, i + 4, _mm256_fmadd_pd(hi, factor, offset), to_float);
+        }
+        break;
+    case ERG_UINT: {
+        /* Bias into signed range, convert, add the bias back (exact in double) */
+        __m128i sign = _mm_set1_epi32(INT32_MIN);
+        __m256d bias = _mm256_set1_pd(2147483648.0);
+        for (; i + 8 <= rows; i += 8) {
+            __m256i v  = _mm256_i32gather_epi32((const int*)(src + i * stride), index8, 1);
+            __m256d lo = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(_mm256_castsi256_si128(v), sign)), bias);
+            __m256d hi = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(_mm256_extracti128_si256(v, 1), sign)), bias);
+            store_scaled4(dest, i, _mm256_fmadd_pd(lo, factor, offset), to_float);
+            store_scaled4(dest, i + 4, _mm256_fmadd_pd(hi, factor, offset), to_float);
+        }
+        break;
+    }
+    case ERG_INT:
+    case ERG_SHORT:
+    case ERG_USHORT:
+    case ERG_CHAR:
+    case ERG_UCHAR: {
+        size_t safe = gather_safe_rows(sig->type_size, stride, rows);
+        for (; i + 8 <= safe; i += 8) {
+            __m256i v  = _mm256_i32gather_epi32((const int*)(src + i * stride), index8, 1);
+            v          = widen_small_ints(v, sig->type);
+            __m256d lo = _mm256_cvtepi32_pd(_mm256_castsi256_si128(v));
+            __m256d hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(v, 1));
+            store_scaled4(dest, i, _mm256_fmadd_pd(lo, factor, offset), to_float);
+            store_scaled4(dest, i + 4, _mm256_fmadd_pd(hi, factor, offset), to_float);
+        }
+        break;
+    }
+    default:
+        /* 64-bit integers have no AVX2 conversion: scalar tail */
+        break;
+    }
+    return i;
+}
+
+/* ---- AVX-512: 8 doubles per vector ---- */
+
+CPU_TARGET_AVX512 static inline void store_scaled8(void* dest, size_t i, __m512d v, int to_float) {
+    if (to_float) {
+        _mm256_storeu_ps((float*)dest + i, _mm512_cvtpd_ps(v));
+    } else {
+        _mm512_storeu_pd((double*)dest + i, v);
+    }
+}
+
+CPU_TARGET_AVX512 static inline __m512i widen_small_ints16(__m512i v, ERGDataType type) {
+    switch (type) {
+    case ERG_SHORT:
+        return _mm512_srai_epi32(_mm512_slli_epi32(v, 16), 16);
+    case ERG_USHORT:
+        return _mm512_and_si512(v, _mm512_set1_epi32(0xFFFF));
+    case ERG_CHAR:
+        return _mm512_srai_epi32(_mm512_slli_epi32(v, 24), 24);
+    case ERG_UCHAR:
+        return _mm512_and_si512(v, _mm512_set1_epi32(0xFF));
+    default:
+        return v;
+    }
+}
+
+CPU_TARGET_AVX512 static size_t convert_rows_avx512(const ERGSignal* sig, const uint8_t* src, size_t stride,
+                                                    size_t rows, void* dest, int to_float) {
+    __m512d factor = _mm512_set1_pd(sig->factor);
+    __m512d offset = _mm512_set1_pd(sig->offset);
+    size_t  i      = 0;
+
+    if (stride > GATHER512_MAX_ROW_SIZE) {
+        return 0;
+    }
+    __m512i index16 = _mm512_mullo_epi32(
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+        _mm512_set1_epi32((int)stride));
+    __m256i index8 = _mm512_castsi512_si256(index16);
+
+    switch (sig->type) {
+    case ERG_DOUBLE:
+        for (; i + 8 <= rows; i += 8) {
+            __m512d v = _mm512_i32gather_pd(index8, (const void*)(src + i * stride), 1);
+            store_scaled8(dest, i, _mm512_fmadd_pd(v, factor, offset), to_float);
+        }
+        break;
+    case ERG_FLOAT:
+        for (; i + 16 <= rows; i += 16) {
+            __m512  v  = _mm512_i32gather_ps(index16, (const void*)(src + i * stride), 1);
+            __m512d lo = _mm512_cvtps_pd(_mm512_castps512_ps256(v));
+            __m512d hi = _mm512_cvtps_pd(_mm512_extractf32x8_ps(v, 1));
+            store_scaled8(dest, i, _mm512_fmadd_pd(lo, factor, offset), to_float);
+            store_scaled8(dest, i + 8, _mm512_fmadd_pd(hi, factor, offset), to_float);
+        }
+        break;
+    case ERG_UINT:
+        for (; i + 16 <= rows; i += 16) {
+            __m512i v  = _mm512_i32gather_epi32(index16, (const void*)(src + i * stride), 1);
+            __m512d lo = _mm512_cvtepu32_pd(_mm512_castsi512_si256(v));
+            __m512d hi = _mm512_cvtepu32_pd(_mm512_extracti64x4_epi64(v, 1));
+            store_scaled8(dest, i, _mm512_fmadd_pd(lo, factor, offset), to_float);
+            store_scaled8(dest, i + 8, _mm512_fmadd_pd(hi, factor, offset), to_float);
+        }
+        break;
+    case ERG_INT:
+    case ERG_SHORT:
+    case ERG_USHORT:
+    case ERG_CHAR:
+    case ERG_UCHAR: {
+        size_t safe = gather_safe_rows(sig->type_size, stride, rows);
+        for (; i + 16 <= safe; i += 16) {
+            __m512i v  = _mm512_i32gather_epi32(index16, (const void*)(src + i * stride), 1);
+            v          = widen_small_ints16(v, sig->type);
+            __m512d lo = _mm512_cvtepi32_pd(_mm512_castsi512_si256(v));
+            __m512d hi = _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(v, 1));
+            store_scaled8(dest, i, _mm512_fmadd_pd(lo, factor, offset), to_float);
+            store_scaled8(dest, i + 8, _mm512_fmadd_pd(hi, factor, offset), to_float);
+        }
+        break;
+    }
+    case ERG_LONGLONG:
+        /* AVX-512DQ converts 64-bit integers directly */
+        for (; i + 8 <= rows; i += 8) {
+            __m512i v = _mm512_i32gather_epi64(index8, (const void*)(src + i * stride), 1);
+            store_scaled8(dest, i, _mm512_fmadd_pd(_mm512_cvtepi64_pd(v), factor, offset), to_float);
+        }
+        break;
+    case ERG_ULONGLONG:
+        for (; i + 8 <= rows; i += 8) {
+            __m512i v = _mm512_i32gather_epi64(index8, (const void*)(src + i * stride), 1);
+            store_scaled8(dest, i, _mm512_fmadd_pd(_mm512_cvtepu64_pd(v), factor, offset), to_float);
+        }
+        break;
+    default:
+        break;
+    }
+    return i;
+}
+
+static void convert_signal_rows(const ERGSignal* sig, const uint8_t* src, size_t stride, size_t rows,
+                                void* dest, int to_float) {
+    size_t       done  = 0;
+    CpuSimdLevel level = cpu_simd_level();
+    if (level >= CPU_SIMD_AVX512) {
+        done = convert_rows_avx512(sig, src, stride, rows, dest, to_float);
+    }
+    if (level >= CPU_SIMD_AVX2 && done < rows) {
+        done += convert_rows_avx2(sig, src + done * stride, stride, rows - done,
+                                  to_float ? (void*)((float*)dest + done) : (void*)((double*)dest + done),
+                                  to_float);
+    }
+    convert_rows_scalar(sig, src, stride, done, rows, dest, to_float);
+}
+
+/* Convert rows [first_row, first_row + rows) of a numeric signal (row-major or columnar) */
+static void convert_signal_range(const ERG* erg, const ERGSignal* sig, size_t first_row, size_t rows,
+                                 void* dest, int to_float) {
+    if (erg->columnar_data) {
+        const uint8_t* column = (const uint8_t*)erg->columnar_data + sig->row_offset * erg->sample_count;
+        convert_signal_rows(sig, column + first_row * sig->type_size, sig->type_size, rows, dest, to_float);
+    } else {
+        const uint8_t* src = erg_row_data(erg) + first_row * erg->row_size + sig->row_offset;
+        convert_signal_rows(sig, src, erg->row_size, rows, dest, to_float);
+    }
+}
+
+/* ============================================================================
+ * TAIL FOLLOW
+ * ============================================================================ */
+
+size_t erg_refresh(ERG* erg) {
+    if (!erg->mapped_data || erg->read_buffer) {
+        return 0;
+    }
+
+    /* Current size of the file being written */
+#ifdef _WIN32
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(erg->file_handle, &size)) {
+        return 0;
+    }
+    size_t new_size = (size_t)size.QuadPart;
+#else
+    struct stat st;
+    if (fstat(erg->file_descriptor, &st) != 0) {
+        return 0;
+    }
+    size_t new_size = (size_t)st.st_size;
+#endif
+
+    /* Nothing to do unless at least one more complete row has arrived */
+    size_t new_samples = (new_size - erg->data_offset) / erg->row_size;
+    if (new_size <= erg->mapped_size || new_samples <= erg->sample_count) {
+        return 0;
+    }
+
+    /* Extend the mapping to cover the new tail */
+#ifdef _WIN32
+    UnmapViewOfFile(erg->mapped_data);
+    CloseHandle(erg->mapping_handle);
+    erg->mapping_handle = CreateFileMappingA(erg->file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!erg->mapping_handle) {
+        fprintf(stderr, "FATAL: Failed to re-create file mapping for ERG file\n");
+        exit(1);
+    }
+    erg->mapped_data = MapViewOfFile(erg->mapping_handle, FILE_MAP_READ, 0, 0, 0);
+    if (!erg->mapped_data) {
+        fprintf(stderr, "FATAL: Failed to re-map view of ERG file\n");
+        exit(1);
+    }
+#elif defined(__linux__)
+    void* remapped = mremap(erg->mapped_data, erg->mapped_size, new_size, MREMAP_MAYMOVE);
+    if (remapped == MAP_FAILED) {
+        fprintf(stderr, "FATAL: Failed to extend ERG file mapping\n");
+        exit(1);
+    }
+    erg->mapped_data = remapped;
+#else
+    munmap(erg->mapped_data, erg->mapped_size);
+    erg->mapped_data = mmap(NULL, new_size, PROT_READ, MAP_PRIVATE, erg->file_descriptor, 0);
+    if (erg->mapped_data == MAP_FAILED) {
+        erg->mapped_data = NULL;
+        fprintf(stderr, "FATAL: Failed to re-map ERG file\n");
+        exit(1);
+    }
+#endif
+
+    size_t added      = new_samples - erg->sample_count;
+    erg->mapped_size  = new_size;
+    apply_map_policy(erg);
+    erg->data_size    = new_size - erg->data_offset;
+    erg->sample_count = new_samples;
+
+    /* The columnar layout depends on sample_count: rebuild it */
+    if (erg->columnar_data) {
+        free(erg->columnar_data);
+        erg->columnar_data = NULL;
+        erg_enable_columnar(erg);
+    }
+
+    /* Re-probe the Time index over the longer column */
+    index_time_column(erg);
+
+    return added;
+}
+
+/* ============================================================================
+ * ASYNC OPEN
+ * ============================================================================ */
+
+/* Alignment of the read buffer, offsets and lengths (direct I/O requirement) */
+#define ERG_READ_ALIGNMENT   4096
+#define ERG_READ_BLOCK_BYTES (4 * 1024 * 1024)
+#define ERG_READ_QUEUE_DEPTH 4
+
+struct ERGAsyncOpen {
+    ERG*           erg;           /* ERG being opened */
+    ParallelGroup* group;         /* Metadata parse (task 0) and block reads (tasks 1..) */
+    uint8_t*       buffer;        /* Aligned buffer receiving the whole file */
+    size_t         file_size;     /* Size of the .erg file */
+    size_t         block_size;    /* Bytes per read request */
+    size_t         block_count;   /* Number of read requests */
+    int            direct;        /* 1 if reads bypass the page cache (aligned offsets only) */
+#ifdef _WIN32
+    HANDLE         file;          /* Data file handle */
+#else
+    int            fd;            /* Data file descriptor */
+#endif
+};
+
+static void* alloc_read_buffer(size_t bytes) {
+#ifdef _WIN32
+    void* buffer = _aligned_malloc(bytes, ERG_READ_ALIGNMENT);
+#else
+    void* buffer = NULL;
+    if (posix_memalign(&buffer, ERG_READ_ALIGNMENT, bytes) != 0) {
+        buffer = NULL;
+    }
+#endif
+    if (!buffer) {
+        fprintf(stderr, "FATAL: Failed to allocate ERG read buffer (%zu bytes)\n", bytes);
+        exit(1);
+    }
+    return buffer;
+}
+
+static void free_read_buffer(void* buffer) {
+#ifdef _WIN32
+    _aligned_free(buffer);
+#else
+    free(buffer);
+#endif
+}
+
+/* Read one block of the file into place. Requests are rounded up to the
+ * alignment (the buffer has room for it); the last one stops short at EOF.
+ * Under direct I/O a short read is retried from its last full aligned
+ * block, since an unaligned offset would fail with EINVAL. */
+static void read_block(ERGAsyncOpen* op, size_t block) {
+    size_t offset = block * op->block_size;
+    size_t want   = op->file_size - offset;
+    if (want > op->block_size) {
+        want = op->block_size;
+    }
+    size_t request = (want + ERG_READ_ALIGNMENT - 1) & ~(size_t)(ERG_READ_ALIGNMENT - 1);
+
+    size_t done = 0;
+    while (done < want) {
+        uint64_t position = (uint64_t)(offset + done);
+#ifdef _WIN32
+        OVERLAPPED overlapped;
+        DWORD      got = 0;
+        memset(&overlapped, 0, sizeof(overlapped));
+        overlapped.Offset     = (DWORD)(position & 0xFFFFFFFFu);
+        overlapped.OffsetHigh = (DWORD)(position >> 32);
+        if (!ReadFile(op->file, op->buffer + offset + done, (DWORD)(request - done), &got, &overlapped)) {
+            got = 0;
+        }
+#else
+        ssize_t got = pread(op->fd, op->buffer + offset + done, request - done, (off_t)position);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+#endif
+        size_t next = done + (size_t)got;
+        if (got > 0 && op->direct && next < want) {
+            next &= ~(size_t)(ERG_READ_ALIGNMENT - 1);
+        }
+        if (got <= 0 || next == done) {
+            fprintf(stderr, "FATAL: Failed to read ERG file at offset %zu\n", offset + done);
+            exit(1);
+        }
+        done = next;
+    }
+}
+
+static void async_open_task(void* context, size_t task) {
+    ERGAsyncOpen* op = (ERGAsyncOpen*)context;
+    if (task == 0) {
+        /* The .erg reads are already queued behind this one */
+        parse_signal_metadata(op->erg);
+    } else {
+        read_block(op, task - 1);
+    }
+}
+
+ERGAsyncOpen* erg_open_async(ERG* erg, const ERGReadOptions* options) {
+    ERGReadOptions defaults;
+    memset(&defaults, 0, sizeof(defaults));
+    if (!options) {
+        options = &defaults;
+    }
+
+    ERGAsyncOpen* op = (ERGAsyncOpen*)calloc(1, sizeof(ERGAsyncOpen));
+    if (!op) {
+        fprintf(stderr, "FATAL: Failed to allocate ERG async open state\n");
+        exit(1);
+    }
+    op->erg        = erg;
+    op->block_size = options->block_size ? options->block_size : ERG_READ_BLOCK_BYTES;
+    op->block_size = (op->block_size + ERG_READ_ALIGNMENT - 1) & ~(size_t)(ERG_READ_ALIGNMENT - 1);
+
+#ifdef _WIN32
+    DWORD flags = FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN;
+    if (options->direct_io) {
+        flags      = FILE_ATTRIBUTE_NORMAL | FILE_FLAG_NO_BUFFERING;
+        op->direct = 1;
+    }
+    op->file = CreateFileA(erg->erg_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, flags, NULL);
+    if (op->file == INVALID_HANDLE_VALUE) {
+        fprintf(stderr, "FATAL: Failed to open ERG file '%s'\n", erg->erg_path);
+        exit(1);
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(op->file, &size)) {
+        fprintf(stderr, "FATAL: Failed to get size of ERG file '%s'\n", erg->erg_path);
+        exit(1);
+    }
+    op->file_size = (size_t)size.QuadPart;
+#else
+    op->fd = -1;
+#ifdef O_DIRECT
+    if (options->direct_io) {
+        /* Not every file system supports direct I/O: fall back to buffered reads */
+        op->fd     = open(erg->erg_path, O_RDONLY | O_DIRECT);
+        op->direct = op->fd >= 0;
+    }
+#endif
+    if (op->fd < 0) {
+        op->fd = open(erg->erg_path, O_RDONLY);
+    }
+    if (op->fd < 0) {
+        fprintf(stderr, "FATAL: Failed to open ERG file '%s'\n", erg->erg_path);
+        exit(1);
+    }
+#if !defined(O_DIRECT) && defined(F_NOCACHE)
+    if (options->direct_io) {
+        fcntl(op->fd, F_NOCACHE, 1);
+    }
+#endif
+    struct stat st;
+    if (fstat(op->fd, &st) != 0) {
+        fprintf(stderr, "FATAL: Failed to get size of ERG file '%s'\n", erg->erg_path);
+        exit(1);
+    }
+    op->file_size = (size_t)st.st_size;
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(op->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+#endif
+
+    size_t buffer_size = (op->file_size + ERG_READ_ALIGNMENT - 1) & ~(size_t)(ERG_READ_ALIGNMENT - 1);
+    op->buffer         = (uint8_t*)alloc_read_buffer(buffer_size > 0 ? buffer_size : ERG_READ_ALIGNMENT);
+    op->block_count    = (op->file_size + op->block_size - 1) / op->block_size;
+
+    /* One extra thread so queue_depth reads stay in flight while the info file is parsed */
+    size_t queue_depth = options->queue_depth ? options->queue_depth : ERG_READ_QUEUE_DEPTH;
+    op->group          = parallel_start(op->block_count + 1, queue_depth + 1, async_open_task, op);
+    return op;
+}
+
+int erg_open_poll(ERGAsyncOpen* op) {
+    return parallel_poll(op->group);
+}
+
+void erg_open_wait(ERGAsyncOpen* op) {
+    parallel_wait(op->group);
+
+#ifdef _WIN32
+    CloseHandle(op->file);
+#else
+    close(op->fd);
+#endif
+
+    /* The buffer stands in for the mapping from here on */
+    ERG* erg = op->erg;
+    set_data_layout(erg, op->file_size);
+    erg->read_buffer = op->buffer;
+    erg->mapped_data = op->buffer;
+    erg->mapped_size = op->file_size;
+    index_time_column(erg);
+
+    free(op);
+}
+
+/* ============================================================================
+ * ROW ITERATOR
+ * ============================================================================ */
+
+/* Minimum size of the sliding mapping used with ERG_ITER_WINDOW */
+#define ERG_ITER_WINDOW_BYTES (16 * 1024 * 1024)
+
+/* Granularity of mapping offsets and page release */
+static size_t iter_page_size(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (size_t)info.dwAllocationGranularity;
+#else
+    long page = sysconf(_SC_PAGESIZE);
+    return page > 0 ? (size_t)page : 4096;
+#endif
+}
+
+/* Release everything before file offset upto (rounded down to a page) */
+static void iter_release(ERGIterator* it, size_t upto) {
+    const ERG* erg = it->erg;
+    upto &= ~(iter_page_size() - 1);
+    if (upto <= it->released) {
+        return;
+    }
+
+    if (it->flags & ERG_ITER_WINDOW) {
+        release_mapped_pages((const uint8_t*)it->window, it->window_offset, it->window_size,
+                            it->released, upto);
+    } else {
+        release_mapped_pages((const uint8_t*)erg->mapped_data, 0, erg->mapped_size, it->released, upto);
+    }
+    evict_cached_pages(erg, it->released, upto);
+    it->released = upto;
+}
+
+static void iter_unmap_window(ERGIterator* it) {
+    if (!it->window) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(it->window);
+#else
+    munmap(it->window, it->window_size);
+#endif
+    it->window      = NULL;
+    it->window_size = 0;
+}
+
+/* Make sure file bytes [start, end) are covered by the sliding mapping */
+static void iter_map_window(ERGIterator* it, size_t start, size_t end) {
+    if (it->window && start >= it->window_offset && end <= it->window_offset + it->window_size) {
+        return;
+    }
+    iter_unmap_window(it);
+
+    const ERG* erg    = it->erg;
+    size_t     offset = start & ~(iter_page_size() - 1);
+    size_t     size   = end - offset;
+    if (size < ERG_ITER_WINDOW_BYTES) {
+        size = ERG_ITER_WINDOW_BYTES;
+    }
+    if (size > erg->mapped_size - offset) {
+        size = erg->mapped_size - offset;
+    }
+
+#ifdef _WIN32
+    uint64_t view_offset = (uint64_t)offset;
+    it->window = MapViewOfFile(erg->mapping_handle, FILE_MAP_READ, (DWORD)(view_offset >> 32),
+                               (DWORD)(view_offset & 0xFFFFFFFFu), size);
+    if (!it->window) {
+        fprintf(stderr, "FATAL: Failed to map ERG iterator window\n");
+        exit(1);
+    }
+#else
+    void* window = mmap(NULL, size, PROT_READ, MAP_PRIVATE, erg->file_descriptor, (off_t)offset);
+    if (window == MAP_FAILED) {
+        fprintf(stderr, "FATAL: Failed to map ERG iterator window\n");
+        exit(1);
+    }
+    madvise(window, size, MADV_SEQUENTIAL);
+    it->window = window;
+#endif
+    it->window_offset = offset;
+    it->window_size   = size;
+}
+
+void erg_iter_init(ERGIterator* it, const ERG* erg, size_t block_rows,
+                   const size_t* columns, size_t column_count, int flags) {
+    memset(it, 0, sizeof(*it));
+    it->erg   = erg;
+    it->flags = flags;
+
+    /* Data read into memory (erg_open_async) has no pages to release or window to map */
+    if (erg->read_buffer) {
+        it->flags &= ~(ERG_ITER_DROP_BEHIND | ERG_ITER_WINDOW);
+    }
+
+    if (block_rows == 0) {
+        block_rows = erg->row_size > 0 ? ERG_BLOCK_BYTES / erg->row_size : 1;
+        if (block_rows == 0) {
+            block_rows = 1;
+        }
+    }
+    it->block_rows = block_rows;
+
+    if (column_count == 0) {
+        return;
+    }
+
+    it->columns     = (size_t*)malloc(column_count * sizeof(size_t));
+    it->column_data = (void**)calloc(column_count, sizeof(void*));
+    if (!it->columns || !it->column_data) {
+        fprintf(stderr, "FATAL: Failed to allocate ERG iterator columns\n");
+        exit(1);
+    }
+    it->column_count = column_count;
+
+    for (size_t k = 0; k < column_count; k++) {
+        if (columns[k] >= erg->signal_count) {
+            fprintf(stderr, "FATAL: Invalid signal index %zu for ERG iterator\n", columns[k]);
+            exit(1);
+        }
+        it->columns[k]     = columns[k];
+        it->column_data[k] = malloc(block_rows * erg->signals[columns[k]].type_size);
+        if (!it->column_data[k]) {
+            fprintf(stderr, "FATAL: Failed to allocate ERG iterator block (%zu rows)\n", block_rows);
+            exit(1);
+        }
+    }
+}
+
+size_t erg_iter_next(ERGIterator* it) {
+    const ERG* erg = it->erg;
+
+    if (it->next_row >= erg->sample_count) {
+        if (it->flags & ERG_ITER_DROP_BEHIND) {
+            iter_release(it, erg->data_offset + erg->sample_count * erg->row_size);
+        }
+        it->first_row = it->next_row;
+        it->rows      = 0;
+        it->row_data  = NULL;
+        return 0;
+    }
+
+    size_t rows = erg->sample_count - it->next_row;
+    if (rows > it->block_rows) {
+        rows = it->block_rows;
+    }
+    size_t start = erg->data_offset + it->next_row * erg->row_size;
+    size_t end   = start + rows * erg->row_size;
+
+    /* The previous block is no longer needed */
+    if (it->flags & ERG_ITER_DROP_BEHIND) {
+        iter_release(it, start);
+    }
+
+    if (it->flags & ERG_ITER_WINDOW) {
+        iter_map_window(it, start, end);
+        it->row_data = (const uint8_t*)it->window + (start - it->window_offset);
+    } else {
+        it->row_data = erg_row_data(erg) + it->next_row * erg->row_size;
+    }
+
+    for (size_t k = 0; k < it->column_count; k++) {
+        const ERGSignal* sig    = &erg->signals[it->columns[k]];
+        ExtractKernel    kernel = select_extract_kernel(sig->type_size, 0);
+        kernel((uint8_t*)it->column_data[k], it->row_data + sig->row_offset, erg->row_size, rows);
+        apply_signal_scaling(it->column_data[k], sig, rows);
+    }
+
+    it->first_row = it->next_row;
+    it->rows      = rows;
+    it->next_row += rows;
+    return rows;
+}
+
+void erg_iter_free(ERGIterator* it) {
+    iter_unmap_window(it);
+    for (size_t k = 0; k < it->column_count; k++) {
+        free(it->column_data[k]);
+    }
+    free(it->column_data);
+    free(it->columns);
+    memset(it, 0, sizeof(*it));
+}
+
+/* ============================================================================
+ * COLUMNAR TRANSPOSE
+ * ============================================================================ */
+
+/* Transpose an 8x8 tile of 4-byte values.
+ * src points at row 0 of the tile, rows are row_size apart.
+ * dst[k] receives the 8 values of column k. */
+CPU_TARGET_AVX2 static inline void transpose_tile_4(const uint8_t* src, size_t row_size, uint8_t* const* dst) {
+    __m256 r0 = _mm256_loadu_ps((const float*)(src + 0 * row_size));
+    __m256 r1 = _mm256_loadu_ps((const float*)(src + 1 * row_size));
+    __m256 r2 = _mm256_loadu_ps((const float*)(src + 2 * row_size));
+    __m256 r3 = _mm256_loadu_ps((const float*)(src + 3 * row_size));
+    __m256 r4 = _mm256_loadu_ps((const float*)(src + 4 * row_size));
+    __m256 r5 = _mm256_loadu_ps((const float*)(src + 5 * row_size));
+    __m256 r6 = _mm256_loadu_ps((const float*)(src + 6 * row_size));
+    __m256 r7 = _mm256_loadu_ps((const float*)(src + 7 * row_size));
+
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+    __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+    __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+    __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+    __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+    _mm256_storeu_ps((float*)dst[0], _mm256_permute2f128_ps(s0, s4, 0x20));
+    _mm256_storeu_ps((float*)dst[1], _mm256_permute2f128_ps(s1, s5, 0x20));
+    _mm256_storeu_ps((float*)dst[2], _mm256_permute2f128_ps(s2, s6, 0x20));
+    _mm256_storeu_ps((float*)dst[3], _mm256_permute2f128_ps(s3, s7, 0x20));
+    _mm256_storeu_ps((float*)dst[4], _mm256_permute2f128_ps(s0, s4, 0x31));
+    _mm256_storeu_ps((float*)dst[5], _mm256_permute2f128_ps(s1, s5, 0x31));
+    _mm256_storeu_ps((float*)dst[6], _mm256_permute2f128_ps(s2, s6, 0x31));
+    _mm256_storeu_ps((float*)dst[7], _mm256_permute2f128_ps(s3, s7, 0x31));
+}
+
+/* Transpose a 4x4 tile of 8-byte values (same conventions as above) */
+CPU_TARGET_AVX2 static inline void transpose_tile_8(const uint8_t* src, size_t row_size, uint8_t* const* dst) {
+    __m256d r0 = _mm256_loadu_pd((const double*)(src + 0 * row_size));
+    __m256d r1 = _mm256_loadu_pd((const double*)(src + 1 * row_size));
+    __m256d r2 = _mm256_loadu_pd((const double*)(src + 2 * row_size));
+    __m256d r3 = _mm256_loadu_pd((const double*)(src + 3 * row_size));
+
+    __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+    __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+    _mm256_storeu_pd((double*)dst[0], _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd((double*)dst[1], _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd((double*)dst[2], _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd((double*)dst[3], _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+/* Transpose the full tiles of a run (same arguments as transpose_run).
+ * Returns the number of columns handled. */
+CPU_TARGET_AVX2 static size_t transpose_tiles_avx2(const ERG* erg, uint8_t* columnar, size_t run_offset,
+                                                   size_t run_length, size_t type_size,
+                                                   const uint8_t* row_data, size_t first_row, size_t rows) {
+    size_t tile = (type_size == 4) ? 8 : (type_size == 8) ? 4 : 0;
+    size_t col  = 0;
+    if (!tile) {
+        return 0;
+    }
+
+    for (; col + tile <= run_length; col += tile) {
+        size_t   offset = run_offset + col * type_size;
+        uint8_t* dst[8];
+        for (size_t k = 0; k < tile; k++) {
+            dst[k] = columnar + (offset + k * type_size) * erg->sample_count +
+                     first_row * type_size;
+        }
+
+        size_t row = 0;
+        for (; row + tile <= rows; row += tile) {
+            const uint8_t* src = row_data + row * erg->row_size + offset;
+            if (type_size == 4) {
+                transpose_tile_4(src, erg->row_size, dst);
+            } else {
+                transpose_tile_8(src, erg->row_size, dst);
+            }
+            for (size_t k = 0; k < tile; k++) {
+                dst[k] += tile * type_size;
+            }
+        }
+        for (; row < rows; row++) {
+            const uint8_t* src = row_data + row * erg->row_size + offset;
+            for (size_t k = 0; k < tile; k++) {
+                memcpy(dst[k], src + k * type_size, type_size);
+                dst[k] += type_size;
+            }
+        }
+    }
+    return col;
+}
+
+/* Transpose rows [first_row, first_row + rows) of a run of consecutive
+ * signals that share the same type size. Full tiles use the AVX2 kernels
+ * when available, leftover columns and rows go through the extract kernels. */
+static void transpose_run(const ERG* erg, uint8_t* columnar, size_t run_offset,
+                          size_t run_length, size_t type_size,
+                          size_t first_row, size_t rows) {
+    const uint8_t* row_data = erg_row_data(erg) + first_row * erg->row_size;
+    size_t         col      = 0;
+
+    if (cpu_simd_level() >= CPU_SIMD_AVX2) {
+        col = transpose_tiles_avx2(erg, columnar, run_offset, run_length, type_size,
+                                   row_data, first_row, rows);
+    }
+
+    /* Remaining columns of the run */
+    ExtractKernel kernel = select_extract_kernel(type_size, erg->sample_count * type_size);
+    for (; col < run_length; col++) {
+        size_t   offset = run_offset + col * type_size;
+        uint8_t* dst    = columnar + offset * erg->sample_count + first_row * type_size;
+        kernel(dst, row_data + offset, erg->row_size, rows);
+    }
+}
+
+void erg_enable_columnar(ERG* erg) {
+    if (erg->columnar_data || erg->sample_count == 0)
+        return;
+
+    size_t   total    = erg->sample_count * erg->row_size;
+    uint8_t* columnar = malloc(total);
+    if (!columnar) {
+        fprintf(stderr, "FATAL: Failed to allocate columnar buffer (%zu bytes)\n", total);
+        exit(1);
+    }
+
+    /* Rows are processed in cache-sized blocks (a multiple of the tile
+     * height), so each block of the mapping is read once while the
+     * per-column output streams are written sequentially. */
+    size_t rows_per_block = (ERG_BLOCK_BYTES / erg->row_size) & ~(size_t)7;
+    if (rows_per_block == 0)
+        rows_per_block = 8;
+
+    for (size_t start = 0; start < erg->sample_count; start += rows_per_block) {
+        size_t rows = erg->sample_count - start;
+        if (rows > rows_per_block)
+            rows = rows_per_block;
+
+        /* Group consecutive signals of equal size into runs */
+        size_t i = 0;
+        while (i < erg->signal_count) {
+            size_t type_size = erg->signals[i].type_size;
+            size_t run_end   = i + 1;
+            while (run_end < erg->signal_count && erg->signals[run_end].type_size == type_size) {
+                run_end++;
+            }
+            transpose_run(erg, columnar, erg->signals[i].row_offset, run_end - i, type_size, start, rows);
+            i = run_end;
+        }
+    }
+
+    erg->columnar_data = columnar;
+}
+
+/* ============================================================================
+ * PUBLIC API
+ * ============================================================================ */
+
+/* Rows per extraction block (one block of rows fits in ERG_BLOCK_BYTES) */
+static size_t erg_rows_per_block(const ERG* erg) {
+    size_t rows_per_block = ERG_BLOCK_BYTES / erg->row_size;
+    return rows_per_block > 0 ? rows_per_block : 1;
+}
+
+/* Resolve the extraction kernel of every requested column (caller frees) */
+static ExtractKernel* select_extract_kernels(const ERG* erg, const size_t* indices, size_t count,
+                                             void* const* out) {
+    ExtractKernel* kernels = malloc((count ? count : 1) * sizeof(ExtractKernel));
+    if (!kernels) {
+        fprintf(stderr, "FATAL: Failed to allocate kernel array (%zu bytes)\n",
+                count * sizeof(ExtractKernel));
+        exit(1);
+    }
+    for (size_t k = 0; k < count; k++) {
+        kernels[k] = NULL;
+        if (out[k]) {
+            const ERGSignal* sig = &erg->signals[indices[k]];
+            kernels[k] = select_extract_kernel(sig->type_size, stream_column_bytes(sig, erg->sample_count));
+        }
+    }
+    return kernels;
+}
+
+/* Extract and scale rows [start, start + rows) of every requested column.
+ * Every column is copied out while the block is still cache-resident, and
+ * scaled before moving on so the output is not walked a second time.
+ * Entries with out[k] == NULL are skipped. */
+static void extract_block(const ERG* erg, const size_t* indices, size_t count,
+                          const ExtractKernel* kernels, void* const* out, size_t start, size_t rows) {
+    for (size_t k = 0; k < count; k++) {
+        if (!out[k])
+            continue;
+        const ERGSignal* sig  = &erg->signals[indices[k]];
+        uint8_t*         dest = (uint8_t*)out[k] + start * sig->type_size;
+        copy_signal_rows(erg, sig, kernels[k], start, rows, dest);
+        apply_signal_scaling(dest, sig, rows);
+    }
+}
+
+/* Sweep the rows once, block by block, extracting into preallocated outputs */
+static void extract_signals_blocked(const ERG* erg, const size_t* indices, size_t count, void** out) {
+    ExtractKernel* kernels        = select_extract_kernels(erg, indices, count, out);
+    size_t         rows_per_block = erg_rows_per_block(erg);
+
+    for (size_t start = 0; start < erg->sample_count; start += rows_per_block) {
+        size_t rows = erg->sample_count - start;
+        if (rows > rows_per_block)
+            rows = rows_per_block;
+        extract_block(erg, indices, count, kernels, out, start, rows);
+    }
+
+    free(kernels);
+    drop_scanned_pages(erg);
+}
+
+/* Shared state of a parallel extraction: one task per block of rows */
+typedef struct {
+    const ERG*           erg;
+    const size_t*        indices;
+    size_t               count;
+    const ExtractKernel* kernels;
+    void* const*         out;
+    size_t               rows_per_block;
+} ParallelExtract;
+
+static void extract_block_task(void* context, size_t task) {
+    const ParallelExtract* job   = (const ParallelExtract*)context;
+    size_t                 start = task * job->rows_per_block;
+    size_t                 rows  = job->erg->sample_count - start;
+    if (rows > job->rows_per_block)
+        rows = job->rows_per_block;
+    extract_block(job->erg, job->indices, job->count, job->kernels, job->out, start, rows);
+}
+
+/* Same result as extract_signals_blocked(), with blocks spread over threads.
+ * Blocks are disjoint row ranges, so workers never write the same bytes. */
+static void extract_signals_parallel(const ERG* erg, const size_t* indices, size_t count, void** out,
+                                     size_t thread_count) {
+    ParallelExtract job;
+    job.erg            = erg;
+    job.indices        = indices;
+    job.count          = count;
+    job.kernels        = select_extract_kernels(erg, indices, count, out);
+    job.out            = out;
+    job.rows_per_block = erg_rows_per_block(erg);
+
+    size_t tasks = (erg->sample_count + job.rows_per_block - 1) / job.rows_per_block;
+    parallel_for(tasks, thread_count, extract_block_task, &job);
+
+    free((void*)job.kernels);
+    drop_scanned_pages(erg);
+}
+
+/* Arena columns start on a cache line so the gather kernels stream whole
+ * aligned vectors into them without a scalar prologue */
+#define ERG_COLUMN_ALIGN 64
+
+static void* arena_alloc_signal(Arena* arena, size_t bytes) {
+    return arena_alloc_aligned(arena, bytes, ERG_COLUMN_ALIGN);
+}
+
+size_t erg_get_signal_into_by_index(const ERG* erg, size_t index, void* dst, size_t dst_capacity) {
+    if (index >= erg->signal_count || erg->sample_count == 0) {
+        return 0;
+    }
+
+    const ERGSignal* sig = &erg->signals[index];
+    if (dst_capacity < erg->sample_count * sig->type_size) {
+        return 0;
+    }
+
+    /* Extract signal data (row-major gather or columnar slice) */
+    copy_signal_rows(erg, sig, select_extract_kernel(sig->type_size, stream_column_bytes(sig, erg->sample_count)),
+                     0, erg->sample_count, (uint8_t*)dst);
+
+    /* Apply scaling if needed */
+    apply_signal_scaling(dst, sig, erg->sample_count);
+
+    drop_scanned_pages(erg);
+    return erg->sample_count;
+}
+
+size_t erg_get_signal_range(const ERG* erg, size_t index, size_t first_sample, size_t count, void* dst) {
+    if (index >= erg->signal_count || first_sample >= erg->sample_count) {
+        return 0;
+    }
+
+    /* Clamp the window to the end of the data */
+    if (count > erg->sample_count - first_sample) {
+        count = erg->sample_count - first_sample;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    /* Only rows inside the window are read, so only their pages fault in */
+    const ERGSignal* sig = &erg->signals[index];
+    copy_signal_rows(erg, sig, select_extract_kernel(sig->type_size, stream_column_bytes(sig, count)),
+                     first_sample, count, (uint8_t*)dst);
+    apply_signal_scaling(dst, sig, count);
+
+    return count;
+}
+
+size_t erg_get_signal_into(const ERG* erg, const char* signal_name, void* dst, size_t dst_capacity) {
+    int index = erg_find_signal_index(erg, signal_name);
+    if (index < 0) {
+        return 0;
+    }
+    return erg_get_signal_into_by_index(erg, (size_t)index, dst, dst_capacity);
+}
+
+void* erg_get_signal(const ERG* erg, const char* signal_name) {
+    int index = erg_find_signal_index(erg, signal_name);
+    if (index < 0) {
+        return NULL;
+    }
+
+    /* Handle empty data case */
+    if (erg->sample_count == 0) {
+        return NULL;
+    }
+
+    const ERGSignal* sig    = &erg->signals[index];
+    void*            result = alloc_signal_array(erg, sig);
+    erg_get_signal_into_by_index(erg, (size_t)index, result, erg->sample_count * sig->type_size);
+    return result;
+}
+
+/* Shared body of erg_get_signal_as_double() and erg_get_signal_as_float() */
+static void* get_signal_converted(const ERG* erg, const char* signal_name, int to_float) {
+    int index = erg_find_signal_index(erg, signal_name);
+    if (index < 0 || erg->sample_count == 0) {
+        return NULL;
+    }
+
+    const ERGSignal* sig = &erg->signals[index];
+    if (sig->type == ERG_BYTES || sig->type == ERG_UNKNOWN) {
+        return NULL;
+    }
+
+    size_t element = to_float ? sizeof(float) : sizeof(double);
+    void*  result  = malloc(erg->sample_count * element);
+    if (!result) {
+        fprintf(stderr, "FATAL: Failed to allocate signal array (%zu bytes)\n",
+                erg->sample_count * element);
+        exit(1);
+    }
+
+    convert_signal_range(erg, sig, 0, erg->sample_count, result, to_float);
+    drop_scanned_pages(erg);
+    return result;
+}
+
+double* erg_get_signal_as_double(const ERG* erg, const char* signal_name) {
+    return (double*)get_signal_converted(erg, signal_name, 0);
+}
+
+float* erg_get_signal_as_float(const ERG* erg, const char* signal_name) {
+    return (float*)get_signal_converted(erg, signal_name, 1);
+}
+
+void* erg_get_signal_arena(const ERG* erg, const char* signal_name, Arena* arena) {
+    int index = erg_find_signal_index(erg, signal_name);
+    if (index < 0 || erg->sample_count == 0) {
+        return NULL;
+    }
+
+    size_t bytes  = erg->sample_count * erg->signals[index].type_size;
+    void*  result = arena_alloc_signal(arena, bytes);
+    erg_get_signal_into_by_index(erg, (size_t)index, result, bytes);
+    return result;
+}
+
+size_t erg_get_signals_by_index(const ERG* erg, const size_t* indices, size_t count, void** out) {
+    size_t found = 0;
+
+    /* Resolve signals and allocate outputs up front */
+    for (size_t k = 0; k < count; k++) {
+        out[k] = NULL;
+        if (indices[k] >= erg->signal_count || erg->sample_count == 0)
+            continue;
+        out[k] = alloc_signal_array(erg, &erg->signals[indices[k]]);
+        found++;
+    }
+
+    if (found > 0) {
+        extract_signals_blocked(erg, indices, count, out);
+    }
+    return found;
+}
+
+void* erg_get_signal_parallel(const ERG* erg, const char* signal_name, size_t thread_count) {
+    int index = erg_find_signal_index(erg, signal_name);
+    if (index < 0 || erg->sample_count == 0) {
+        return NULL;
+    }
+
+    size_t signal_index = (size_t)index;
+    void*  result       = alloc_signal_array(erg, &erg->signals[signal_index]);
+    extract_signals_parallel(erg, &signal_index, 1, &result, thread_count);
+    return result;
+}
+
+size_t erg_get_signals_parallel(const ERG* erg, const size_t* indices, size_t count, void** out,
+                                size_t thread_count) {
+    size_t found = 0;
+
+    for (size_t k = 0; k < count; k++) {
+        out[k] = NULL;
+        if (indices[k] >= erg->signal_count || erg->sample_count == 0)
+            continue;
+        out[k] = alloc_signal_array(erg, &erg->signals[indices[k]]);
+        found++;
+    }
+
+    if (found > 0) {
+        extract_signals_parallel(erg, indices, count, out, thread_count);
+    }
+    return found;
+}
+
+size_t erg_get_signals_arena(const ERG* erg, const size_t* indices, size_t count, void** out, Arena* arena) {
+    size_t found = 0;
+
+    for (size_t k = 0; k < count; k++) {
+        out[k] = NULL;
+        if (indices[k] >= erg->signal_count || erg->sample_count == 0)
+            continue;
+        out[k] = arena_alloc_signal(arena, erg->sample_count * erg->signals[indices[k]].type_size);
+        found++;
+    }
+
+    if (found > 0) {
+        extract_signals_blocked(erg, indices, count, out);
+    }
+    return found;
+}
+
+size_t erg_get_signals(const ERG* erg, const char* const* signal_names, size_t count, void** out) {
+    size_t* indices = malloc((count ? count : 1) * sizeof(size_t));
+    if (!indices) {
+        fprintf(stderr, "FATAL: Failed to allocate indices array (%zu bytes)\n",
+                count * sizeof(size_t));
+        exit(1);
+    }
+
+    /* Unknown names map to an out-of-range index and come back as NULL */
+    for (size_t k = 0; k < count; k++) {
+        int index  = erg_find_signal_index(erg, signal_names[k]);
+        indices[k] = index < 0 ? erg->signal_count : (size_t)index;
+    }
+
+    size_t found = erg_get_signals_by_index(erg, indices, count, out);
+    free(indices);
+    return found;
+}
+
+/* ============================================================================
+ * MIN/MAX DECIMATION
+ * Per-bucket extrema computed straight from the mapped rows (or the
+ * columnar buffer, which is the same walk with stride == type_size).
+ * Raw extrema are found first and scaled once per bucket.
+ * ============================================================================ */
+
+/* Horizontal min/max of AVX vectors */
+CPU_TARGET_AVX2 static inline double hmin_pd(__m256d v) {
+    __m128d m = _mm_min_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_min_sd(m, _mm_unpackhi_pd(m, m)));
+}
+
+CPU_TARGET_AVX2 static inline double hmax_pd(__m256d v) {
+    __m128d m = _mm_max_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_max_sd(m, _mm_unpackhi_pd(m, m)));
+}
+
+/* AVX2 gather passes over the first rows; return the number of rows consumed
+ * and leave the rest to the scalar loops below */
+CPU_TARGET_AVX2 static size_t minmax_f32_avx2(const uint8_t* src, size_t stride, size_t rows, float* mn, float* mx) {
+    size_t i = 0;
+    if (rows < 8 || stride > GATHER_MAX_ROW_SIZE) {
+        return 0;
+    }
+
+    __m256i index = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                       _mm256_set1_epi32((int)stride));
+    __m256  vmin  = _mm256_set1_ps(INFINITY);
+    __m256  vmax  = _mm256_set1_ps(-INFINITY);
+    for (; i + 8 <= rows; i += 8) {
+        __m256 v = _mm256_i32gather_ps((const float*)(src + i * stride), index, 1);
+        vmin     = _mm256_min_ps(v, vmin);
+        vmax     = _mm256_max_ps(v, vmax);
+    }
+    __m128 lo = _mm_min_ps(_mm256_castps256_ps128(vmin), _mm256_extractf128_ps(vmin, 1));
+    __m128 hi = _mm_max_ps(_mm256_castps256_ps128(vmax), _mm256_extractf128_ps(vmax, 1));
+    lo        = _mm_min_ps(lo, _mm_movehl_ps(lo, lo));
+    hi        = _mm_max_ps(hi, _mm_movehl_ps(hi, hi));
+    lo        = _mm_min_ss(lo, _mm_shuffle_ps(lo, lo, 1));
+    hi        = _mm_max_ss(hi, _mm_shuffle_ps(hi, hi, 1));
+    *mn       = _mm_cvtss_f32(lo);
+    *mx       = _mm_cvtss_f32(hi);
+    return i;
+}
+
+CPU_TARGET_AVX2 static size_t minmax_f64_avx2(const uint8_t* src, size_t stride, size_t rows, double* mn, double* mx) {
+    size_t i = 0;
+    if (rows < 4 || stride > GATHER_MAX_ROW_SIZE) {
+        return 0;
+    }
+
+    __m128i index = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32((int)stride));
+    __m256d vmin  = _mm256_set1_pd(INFINITY);
+    __m256d vmax  = _mm256_set1_pd(-INFINITY);
+    for (; i + 4 <= rows; i += 4) {
+        __m256d v = _mm256_i32gather_pd((const double*)(src + i * stride), index, 1);
+        vmin      = _mm256_min_pd(v, vmin);
+        vmax      = _mm256_max_pd(v, vmax);
+    }
+    *mn = hmin_pd(vmin);
+    *mx = hmax_pd(vmax);
+    return i;
+}
+
+/* NaN samples are skipped: the new value is the first operand of min/max,
+ * so the accumulator wins whenever the sample is NaN */
+static void minmax_f32(const uint8_t* src, size_t stride, size_t rows, double* out_min, double* out_max) {
+    float  mn = INFINITY, mx = -INFINITY;
+    size_t i  = 0;
+
+    if (cpu_simd_level() >= CPU_SIMD_AVX2) {
+        i = minmax_f32_avx2(src, stride, rows, &mn, &mx);
+    }
+
+    for (; i < rows; i++) {
+        float v;
+        memcpy(&v, src + i * stride, sizeof(v));
+        if (v < mn)
+            mn = v;
+        if (v > mx)
+            mx = v;
+    }
+    *out_min = mn;
+    *out_max = mx;
+}
+
+static void minmax_f64(const uint8_t* src, size_t stride, size_t rows, double* out_min, double* out_max) {
+    double mn = INFINITY, mx = -INFINITY;
+    size_t i  = 0;
+
+    if (cpu_simd_level() >= CPU_SIMD_AVX2) {
+        i = minmax_f64_avx2(src, stride, rows, &mn, &mx);
+    }
+
+    for (; i < rows; i++) {
+        double v;
+        memcpy(&v, src + i * stride, sizeof(v));
+        if (v < mn)
+            mn = v;
+        if (v > mx)
+            mx = v;
+    }
+    *out_min = mn;
+    *out_max = mx;
+}
+
+static void minmax_generic(const uint8_t* src, size_t stride, size_t rows, ERGDataType type,
+                           double* out_min, double* out_max) {
+    double mn = INFINITY, mx = -INFINITY;
+    for (size_t i = 0; i < rows; i++) {
+        double v = raw_to_double(src + i * stride, type);
+        if (v < mn)
+            mn = v;
+        if (v > mx)
+            mx = v;
+    }
+    *out_min = mn;
+    *out_max = mx;
+}
+
+/* Scaled min/max of rows [first_row, first_row + rows) of one signal.
+ * Both results are NaN if every sample is NaN. */
+static void signal_window_minmax(const ERG* erg, const ERGSignal* sig, size_t first_row, size_t rows,
+                                 double* out_min, double* out_max) {
+    /* Columnar data is the same walk with a stride of one element */
+    const uint8_t* src;
+    size_t         stride;
+    if (erg->columnar_data) {
+        src    = (const uint8_t*)erg->columnar_data + sig->row_offset * erg->sample_count;
+        stride = sig->type_size;
+    } else {
+        src    = erg_row_data(erg) + sig->row_offset;
+        stride = erg->row_size;
+    }
+    src += first_row * stride;
+
+    double raw_min, raw_max;
+    if (sig->type == ERG_FLOAT) {
+        minmax_f32(src, stride, rows, &raw_min, &raw_max);
+    } else if (sig->type == ERG_DOUBLE) {
+        minmax_f64(src, stride, rows, &raw_min, &raw_max);
+    } else {
+        minmax_generic(src, stride, rows, sig->type, &raw_min, &raw_max);
+    }
+
+    if (raw_min > raw_max) {
+        /* Every sample was NaN */
+        *out_min = NAN;
+        *out_max = NAN;
+    } else if (sig->factor >= 0.0) {
+        /* fma() rounds like the convert kernels, independent of contraction */
+        *out_min = fma(raw_min, sig->factor, sig->offset);
+        *out_max = fma(raw_max, sig->factor, sig->offset);
+    } else {
+        /* A negative factor swaps the extrema */
+        *out_min = fma(raw_max, sig->factor, sig->offset);
+        *out_max = fma(raw_min, sig->factor, sig->offset);
+    }
+}
+
+/* Validate and clamp a decimation request; returns the usable bucket count */
+static size_t clamp_minmax_request(const ERG* erg, size_t index, size_t first_sample,
+                                   size_t* count, size_t bucket_count) {
+    if (index >= erg->signal_count || first_sample >= erg->sample_count || bucket_count == 0) {
+        return 0;
+    }
+    const ERGSignal* sig = &erg->signals[index];
+    if (sig->type == ERG_BYTES || sig->type == ERG_UNKNOWN) {
+        return 0;
+    }
+    if (*count > erg->sample_count - first_sample) {
+        *count = erg->sample_count - first_sample;
+    }
+    return bucket_count > *count ? *count : bucket_count;
+}
+
+size_t erg_get_signal_minmax(const ERG* erg, size_t index, size_t first_sample, size_t count,
+                             size_t bucket_count, ERGBucket* out) {
+    bucket_count = clamp_minmax_request(erg, index, first_sample, &count, bucket_count);
+    if (bucket_count == 0) {
+        return 0;
+    }
+
+    const ERGSignal* sig = &erg->signals[index];
+    for (size_t b = 0; b < bucket_count; b++) {
+        /* Spread samples evenly: bucket b covers [b*count/n, (b+1)*count/n) */
+        size_t start = first_sample + (size_t)((uint64_t)b * count / bucket_count);
+        size_t end   = first_sample + (size_t)((uint64_t)(b + 1) * count / bucket_count);
+
+        ERGBucket* bucket = &out[b];
+        signal_window_minmax(erg, sig, start, end - start, &bucket->min, &bucket->max);
+        bucket->first = read_sample_as_double(erg, sig, start);
+        bucket->last  = read_sample_as_double(erg, sig, end - 1);
+    }
+
+    return bucket_count;
+}
+
+/* ============================================================================
+ * STATISTICS
+ * ============================================================================ */
+
+/* Rows converted per selected signal between reductions */
+#define ERG_STATS_CHUNK 2048
+
+/* Scratch of one signal group (ERG_STATS_CHUNK doubles per member), sized to stay in L2 */
+#define ERG_STATS_GROUP_BYTES (512 * 1024)
+
+/* Running statistics of one signal, merged chunk by chunk */
+typedef struct {
+    double       min;
+    double       max;
+    double       mean;
+    double       m2;           /* Sum of squared deviations from mean */
+    size_t       count;
+    size_t       nan_count;
+    size_t       inf_count;
+} StatsAccumulator;
+
+/* Set bits in a 4-bit movemask */
+static const uint8_t mask_bit_count[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+/* Result of the first pass over the 4-lane body of a chunk */
+typedef struct {
+    double sum;
+    double min;
+    double max;
+    size_t finite;
+    size_t nan;
+} StatsLanes;
+
+CPU_TARGET_AVX2 static inline double hsum_pd(__m256d v) {
+    __m128d m = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(m, _mm_unpackhi_pd(m, m)));
+}
+
+/* Both lane passes return the number of samples consumed (a multiple of 4) */
+CPU_TARGET_AVX2 static size_t stats_lanes_avx2(const double* x, size_t n, StatsLanes* out) {
+    const __m256d zero    = _mm256_setzero_pd();
+    const __m256d pos_inf = _mm256_set1_pd(INFINITY);
+    const __m256d neg_inf = _mm256_set1_pd(-INFINITY);
+
+    __m256d vsum = zero;
+    __m256d vmin = pos_inf;
+    __m256d vmax = neg_inf;
+    size_t  i    = 0;
+    out->finite  = 0;
+    out->nan     = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d v      = _mm256_loadu_pd(x + i);
+        __m256d is_fin = _mm256_cmp_pd(_mm256_sub_pd(v, v), zero, _CMP_EQ_OQ); /* Inf - Inf is NaN */
+        __m256d is_nan = _mm256_cmp_pd(v, v, _CMP_UNORD_Q);
+        out->finite += mask_bit_count[_mm256_movemask_pd(is_fin)];
+        out->nan += mask_bit_count[_mm256_movemask_pd(is_nan)];
+        vsum = _mm256_add_pd(vsum, _mm256_and_pd(v, is_fin));
+        vmin = _mm256_min_pd(vmin, _mm256_blendv_pd(pos_inf, v, is_fin));
+        vmax = _mm256_max_pd(vmax, _mm256_blendv_pd(neg_inf, v, is_fin));
+    }
+    out->sum = hsum_pd(vsum);
+    out->min = hmin_pd(vmin);
+    out->max = hmax_pd(vmax);
+    return i;
+}
+
+CPU_TARGET_AVX2 static size_t stats_m2_lanes_avx2(const double* x, size_t n, double mean, double* m2) {
+    const __m256d zero  = _mm256_setzero_pd();
+    __m256d       vmean = _mm256_set1_pd(mean);
+    __m256d       vm2   = zero;
+    size_t        i     = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d v      = _mm256_loadu_pd(x + i);
+        __m256d is_fin = _mm256_cmp_pd(_mm256_sub_pd(v, v), zero, _CMP_EQ_OQ);
+        __m256d d      = _mm256_and_pd(_mm256_sub_pd(v, vmean), is_fin);
+        vm2            = _mm256_fmadd_pd(d, d, vm2);
+    }
+    *m2 = hsum_pd(vm2);
+    return i;
+}
+
+/* Scalar twins of the lane passes: four accumulators combined in the same
+ * order as hsum_pd/hmin_pd/hmax_pd, so every SIMD level gives identical bits */
+static inline double lane_min(double a, double b) {
+    return a < b ? a : b; /* MINPD operand semantics */
+}
+
+static inline double lane_max(double a, double b) {
+    return a > b ? a : b;
+}
+
+static size_t stats_lanes_scalar(const double* x, size_t n, StatsLanes* out) {
+    double sum[4] = {0.0, 0.0, 0.0, 0.0};
+    double mn[4]  = {INFINITY, INFINITY, INFINITY, INFINITY};
+    double mx[4]  = {-INFINITY, -INFINITY, -INFINITY, -INFINITY};
+    size_t i      = 0;
+    out->finite   = 0;
+    out->nan      = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (size_t k = 0; k < 4; k++) {
+            double v   = x[i + k];
+            int    fin = isfinite(v);
+            out->finite += fin;
+            out->nan += isnan(v) != 0;
+            sum[k] += fin ? v : 0.0;
+            mn[k] = lane_min(mn[k], fin ? v : INFINITY);
+            mx[k] = lane_max(mx[k], fin ? v : -INFINITY);
+        }
+    }
+    out->sum = (sum[0] + sum[2]) + (sum[1] + sum[3]);
+    out->min = lane_min(lane_min(mn[0], mn[2]), lane_min(mn[1], mn[3]));
+    out->max = lane_max(lane_max(mx[0], mx[2]), lane_max(mx[1], mx[3]));
+    return i;
+}
+
+static size_t stats_m2_lanes_scalar(const double* x, size_t n, double mean, double* m2) {
+    double acc[4] = {0.0, 0.0, 0.0, 0.0};
+    size_t i      = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (size_t k = 0; k < 4; k++) {
+            double d = isfinite(x[i + k]) ? x[i + k] - mean : 0.0;
+            acc[k]   = fma(d, d, acc[k]);
+        }
+    }
+    *m2 = (acc[0] + acc[2]) + (acc[1] + acc[3]);
+    return i;
+}
+
+/* Fold one chunk of scaled samples into acc: a 4-lane pass for count, sum
+ * and extrema, a second pass (still in L1) for squared deviations, then a
+ * pairwise merge of mean and M2 */
+static void stats_accumulate(StatsAccumulator* acc, const double* x, size_t n) {
+    int        avx2 = cpu_simd_level() >= CPU_SIMD_AVX2;
+    StatsLanes lanes;
+    size_t     i = avx2 ? stats_lanes_avx2(x, n, &lanes) : stats_lanes_scalar(x, n, &lanes);
+
+    size_t finite = lanes.finite;
+    size_t nan    = lanes.nan;
+    double sum    = lanes.sum;
+    double min    = lanes.min;
+    double max    = lanes.max;
+    for (; i < n; i++) {
+        if (isnan(x[i])) {
+            nan++;
+        } else if (isfinite(x[i])) {
+            finite++;
+            sum += x[i];
+            min = x[i] < min ? x[i] : min;
+            max = x[i] > max ? x[i] : max;
+        }
+    }
+
+    acc->nan_count += nan;
+    acc->inf_count += n - finite - nan;
+    if (finite == 0) {
+        return;
+    }
+
+    double mean = sum / (double)finite;
+    double m2;
+    i = avx2 ? stats_m2_lanes_avx2(x, n, mean, &m2) : stats_m2_lanes_scalar(x, n, mean, &m2);
+    for (; i < n; i++) {
+        if (isfinite(x[i])) {
+            m2 += (x[i] - mean) * (x[i] - mean);
+        }
+    }
+
+    if (acc->count == 0) {
+        acc->min = min;
+        acc->max = max;
+        acc->mean = mean;
+        acc->m2   = m2;
+    } else {
+        double total = (double)(acc->count + finite);
+        double delta = mean - acc->mean;
+        acc->mean += delta * (double)finite / total;
+        acc->m2 += m2 + delta * delta * (double)acc->count * (double)finite / total;
+        acc->min = min < acc->min ? min : acc->min;
+        acc->max = max > acc->max ? max : acc->max;
+    }
+    acc->count += finite;
+}
+
+/* Signals the statistics sweep can convert */
+static int stats_signal_usable(const ERG* erg, size_t index) {
+    return index < erg->signal_count && erg->signals[index].type != ERG_BYTES &&
+           erg->signals[index].type != ERG_UNKNOWN;
+}
+
+size_t erg_compute_stats(const ERG* erg, const size_t* selection, size_t count, ERGStats* out) {
+    if (!selection) {
+        count = erg->signal_count;
+    }
+
+    size_t            group_size = ERG_STATS_GROUP_BYTES / (ERG_STATS_CHUNK * sizeof(double));
+    StatsAccumulator* acc        = calloc(count ? count : 1, sizeof(StatsAccumulator));
+    size_t*           group      = malloc(group_size * sizeof(size_t));
+    double*           scratch    = malloc(group_size * ERG_STATS_CHUNK * sizeof(double));
+    if (!acc || !group || !scratch) {
+        fprintf(stderr, "FATAL: Failed to allocate statistics buffers\n");
+        exit(1);
+    }
+
+    /* Resolve the selection; unusable entries keep count 0 */
+    size_t computed = 0;
+    for (size_t k = 0; k < count; k++) {
+        size_t index = selection ? selection[k] : k;
+        out[k].min = out[k].max = out[k].mean = out[k].variance = NAN;
+        out[k].first = out[k].last = NAN;
+        out[k].count = out[k].nan_count = out[k].inf_count = 0;
+        if (stats_signal_usable(erg, index) && erg->sample_count > 0) {
+            computed++;
+        }
+    }
+
+    /* Tiles of ERG_STATS_CHUNK rows, so every reduction covers a full chunk
+     * even when a block of rows is only a dozen wide rows. Inside a tile the
+     * selection is converted a group at a time, block by block, so each block
+     * of rows is reused by all members of the group while it is cached. */
+    size_t rows_per_block = erg_rows_per_block(erg);
+    if (rows_per_block > ERG_STATS_CHUNK) {
+        rows_per_block = ERG_STATS_CHUNK;
+    }
+    for (size_t tile = 0; computed > 0 && tile < erg->sample_count; tile += ERG_STATS_CHUNK) {
+        size_t tile_rows = erg->sample_count - tile;
+        if (tile_rows > ERG_STATS_CHUNK) {
+            tile_rows = ERG_STATS_CHUNK;
+        }
+        size_t k = 0;
+        while (k < count) {
+            size_t members = 0;
+            for (; k < count && members < group_size; k++) {
+                if (stats_signal_usable(erg, selection ? selection[k] : k)) {
+                    group[members++] = k;
+                }
+            }
+
+            for (size_t start = 0; start < tile_rows; start += rows_per_block) {
+                size_t rows = tile_rows - start;
+                if (rows > rows_per_block) {
+                    rows = rows_per_block;
+                }
+                for (size_t m = 0; m < members; m++) {
+                    size_t index = selection ? selection[group[m]] : group[m];
+                    convert_signal_range(erg, &erg->signals[index], tile + start, rows,
+                                         scratch + m * ERG_STATS_CHUNK + start, 0);
+                }
+            }
+
+            for (size_t m = 0; m < members; m++) {
+                const double* x = scratch + m * ERG_STATS_CHUNK;
+                if (tile == 0) {
+                    out[group[m]].first = x[0];
+                }
+                if (tile + tile_rows == erg->sample_count) {
+                    out[group[m]].last = x[tile_rows - 1];
+                }
+                stats_accumulate(&acc[group[m]], x, tile_rows);
+            }
+        }
+    }
+
+    for (size_t k = 0; k < count; k++) {
+        out[k].count     = acc[k].count;
+        out[k].nan_count = acc[k].nan_count;
+        out[k].inf_count = acc[k].inf_count;
+        if (acc[k].count > 0) {
+            out[k].min      = acc[k].min;
+            out[k].max      = acc[k].max;
+            out[k].mean     = acc[k].mean;
+            out[k].variance = acc[k].m2 / (double)acc[k].count;
+        }
+    }
+
+    free(scratch);
+    free(group);
+    free(acc);
+    if (computed > 0) {
+        drop_scanned_pages(erg);
+    }
+    return computed;
+}
+
+/* ============================================================================
+ * KEY INDEX
+ * Lookup of sample positions by the value of a non-decreasing column.
+ * Keys are read straight from the data: a uniform column maps a key to
+ * its sample in O(1), anything else gallops from the last result.
+ * ============================================================================ */
+
+/* Probes used to decide whether a column is uniformly sampled */
+#define KEY_INDEX_PROBES 16
+
+int erg_key_index_init(ERGKeyIndex* index, const ERG* erg, size_t signal_index) {
+    memset(index, 0, sizeof(ERGKeyIndex));
+
+    if (signal_index >= erg->signal_count || erg->sample_count == 0) {
+        return -1;
+    }
+    const ERGSignal* sig = &erg->signals[signal_index];
+    if (sig->type == ERG_BYTES || sig->type == ERG_UNKNOWN) {
+        return -1;
+    }
+
+    index->signal_index = signal_index;
+    index->sample_count = erg->sample_count;
+    index->first        = read_sample_as_double(erg, sig, 0);
+    index->last         = read_sample_as_double(erg, sig, erg->sample_count - 1);
+
+    if (erg->sample_count < 2 || !(index->last > index->first)) {
+        return 0;
+    }
+
+    /* Assume a constant step and check it at evenly spaced probes.
+     * This is only a fast path: lookups verify and correct every guess,
+     * so a wrong assumption costs time, never correctness. */
+    double step = (index->last - index->first) / (double)(erg->sample_count - 1);
+    for (size_t k = 1; k < KEY_INDEX_PROBES; k++) {
+        size_t row      = (erg->sample_count - 1) * k / KEY_INDEX_PROBES;
+        double expected = index->first + step * (double)row;
+        if (fabs(read_sample_as_double(erg, sig, row) - expected) > step * 1e-3) {
+            return 0;
+        }
+    }
+    index->step    = step;
+    index->uniform = 1;
+    return 0;
+}
+
+/* First sample whose key is >= key (or > key when strict), in [0, sample_count] */
+static size_t key_index_search(const ERG* erg, ERGKeyIndex* index, double key, int strict) {
+    const ERGSignal* sig = &erg->signals[index->signal_index];
+    size_t           n   = index->sample_count;
+
+#define KEY_BEFORE(row) (strict ? read_sample_as_double(erg, sig, (row)) <= key \
+                                : read_sample_as_double(erg, sig, (row)) < key)
+
+    /* Starting guess: direct computation for uniform data, else last result */
+    size_t guess = index->hint;
+    if (index->uniform) {
+        double pos = ceil((key - index->first) / index->step);
+        guess      = pos <= 0.0 ? 0 : pos >= (double)n ? n - 1 : (size_t)pos;
+    }
+    if (guess >= n) {
+        guess = n - 1;
+    }
+
+    /* Gallop away from the guess until the boundary is bracketed by (lo, hi] */
+    size_t lo, hi;
+    if (KEY_BEFORE(guess)) {
+        size_t jump = 1;
+        lo          = guess;
+        hi          = guess + 1;
+        while (hi < n && KEY_BEFORE(hi)) {
+            lo = hi;
+            hi = (n - hi > jump) ? hi + jump : n;
+            jump *= 2;
+        }
+        lo++;
+    } else {
+        size_t jump = 1;
+        hi          = guess;
+        lo          = guess;
+        while (lo > 0) {
+            size_t probe = (lo > jump) ? lo - jump : 0;
+            if (KEY_BEFORE(probe)) {
+                lo = probe + 1;
+                break;
+            }
+            hi = probe;
+            lo = probe;
+            jump *= 2;
+        }
+    }
+
+    /* Binary search for the boundary in [lo, hi] */
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (KEY_BEFORE(mid)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+#undef KEY_BEFORE
+
+    index->hint = lo < n ? lo : n - 1;
+    return lo;
+}
+
+size_t erg_key_index_lower_bound(const ERG* erg, ERGKeyIndex* index, double key) {
+    if (index->sample_count == 0) {
+        return 0;
+    }
+    return key_index_search(erg, index, key, 0);
+}
+
+size_t erg_key_index_range(const ERG* erg, ERGKeyIndex* index, double lo, double hi, size_t* first) {
+    *first = 0;
+    if (index->sample_count == 0 || !(lo <= hi)) {
+        return 0;
+    }
+    size_t begin = key_index_search(erg, index, lo, 0);
+    size_t end   = key_index_search(erg, index, hi, 1);
+    *first       = begin;
+    return end > begin ? end - begin : 0;
+}
+
+size_t erg_find_time_range(ERG* erg, double t0, double t1, size_t* first) {
+    return erg_key_index_range(erg, &erg->time_index, t0, t1, first);
+}
+
+/* ============================================================================
+ * LOD PYRAMID SIDECAR
+ * <file>.erg.lod stores per-signal min/max for power-of-two bucket sizes
+ * (level l holds buckets of ERG_LOD_BASE_BUCKET << l samples) so a view of
+ * any width is answered from the coarsest level that fits.
+ * ============================================================================ */
+
+#define ERG_LOD_MAGIC       "ERGLOD3"
+#define ERG_LOD_BASE_BUCKET 64 /* Samples per level-0 bucket */
+
+/* On-disk header, followed by signal_count pyramids of (min, max) doubles */
+typedef struct {
+    char     magic[8];
+    uint64_t erg_size;     /* Size of the .erg file the pyramid was built from */
+    int64_t  erg_mtime;    /* Modification time of that .erg file (see file_identity) */
+    uint64_t info_size;    /* Size of the .erg.info file (types, factors, offsets) */
+    int64_t  info_mtime;   /* Modification time of the .erg.info file */
+    uint64_t signal_count;
+    uint64_t sample_count;
+    uint64_t row_size;
+    uint64_t base_bucket;
+    uint64_t level_count;
+} ERGLodHeader;
+
+/* Identity of the .erg and .erg.info files a pyramid is built from. The
+ * pyramid holds scaled values, so a changed factor, offset or type in the
+ * .erg.info invalidates it just like a changed .erg. */
+typedef struct {
+    uint64_t erg_size;
+    int64_t  erg_mtime;
+    uint64_t info_size;
+    int64_t  info_mtime;
+} ERGLodSource;
+
+/* Size and modification time of a file, -1 if it cannot be stat'ed.
+ * mtime keeps the sub-second part (nanoseconds on POSIX, 100 ns ticks on
+ * Windows), so a same-size rewrite within one second is still detected. */
+static int file_identity(const char* path, uint64_t* size, int64_t* mtime) {
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA attr;
+    if (!GetFileAttributesExA(path, GetFileExInfoStandard, &attr)) {
+        return -1;
+    }
+    *size  = ((uint64_t)attr.nFileSizeHigh << 32) | attr.nFileSizeLow;
+    *mtime = (int64_t)(((uint64_t)attr.ftLastWriteTime.dwHighDateTime << 32) |
+                       attr.ftLastWriteTime.dwLowDateTime);
+#else
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return -1;
+    }
+    *size = (uint64_t)st.st_size;
+#if defined(__APPLE__)
+    *mtime = (int64_t)st.st_mtimespec.tv_sec * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+    *mtime = (int64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+#endif
+    return 0;
+}
+
+/* Map a whole file read-only; NULL on failure. Handles are not kept open. */
+static void* map_whole_file(const char* path, size_t* size) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        return NULL;
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping) {
+        return NULL;
+    }
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data) {
+        return NULL;
+    }
+    *size = (size_t)file_size.QuadPart;
+    return data;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd == -1) {
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return NULL;
+    }
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return NULL;
+    }
+    *size = (size_t)st.st_size;
+    return data;
+#endif
+}
+
+static void unmap_whole_file(void* data, size_t size) {
+#ifdef _WIN32
+    (void)size;
+    UnmapViewOfFile(data);
+#else
+    munmap(data, size);
+#endif
+}
+
+/* Fill in the level layout for a given sample count */
+static void lod_layout(ERGLod* lod, size_t signal_count, size_t sample_count, size_t base_bucket) {
+    lod->signal_count  = signal_count;
+    lod->sample_count  = sample_count;
+    lod->base_bucket   = base_bucket;
+    lod->level_count   = 0;
+    lod->signal_stride = 0;
+
+    size_t bucket_size = base_bucket;
+    while (lod->level_count < ERG_LOD_MAX_LEVELS) {
+        size_t buckets = (sample_count + bucket_size - 1) / bucket_size;
+        lod->level_buckets[lod->level_count] = buckets;
+        lod->level_offset[lod->level_count]  = lod->signal_stride;
+        lod->signal_stride += 2 * buckets;
+        lod->level_count++;
+        if (buckets <= 1)
+            break;
+        bucket_size *= 2;
+    }
+}
+
+/* Compute the whole pyramid: level 0 in one blocked sweep over the rows,
+ * every further level by merging pairs of buckets from the level below */
+static double* lod_build_pyramid(const ERG* erg, const ERGLod* lod) {
+    size_t  total = lod->signal_count * lod->signal_stride;
+    double* data  = malloc(total * sizeof(double));
+    if (!data) {
+        fprintf(stderr, "FATAL: Failed to allocate LOD pyramid (%zu bytes)\n", total * sizeof(double));
+        exit(1);
+    }
+
+    size_t base           = lod->base_bucket;
+    size_t rows_per_block = (ERG_BLOCK_BYTES / erg->row_size) / base * base;
+    if (rows_per_block == 0)
+        rows_per_block = base;
+
+    for (size_t start = 0; start < erg->sample_count; start += rows_per_block) {
+        size_t end = start + rows_per_block;
+        if (end > erg->sample_count)
+            end = erg->sample_count;
+
+        for (size_t s = 0; s < lod->signal_count; s++) {
+            const ERGSignal* sig     = &erg->signals[s];
+            int              numeric = sig->type != ERG_BYTES && sig->type != ERG_UNKNOWN;
+            double*          level0  = data + s * lod->signal_stride;
+            for (size_t row = start; row < end; row += base) {
+                size_t  rows   = (end - row < base) ? end - row : base;
+                double* bucket = level0 + 2 * (row / base);
+                if (numeric) {
+                    signal_window_minmax(erg, sig, row, rows, &bucket[0], &bucket[1]);
+                } else {
+                    bucket[0] = NAN;
+                    bucket[1] = NAN;
+                }
+            }
+        }
+    }
+
+    for (size_t s = 0; s < lod->signal_count; s++) {
+        double* pyramid = data + s * lod->signal_stride;
+        for (size_t l = 1; l < lod->level_count; l++) {
+            const double* below       = pyramid + lod->level_offset[l - 1];
+            double*       level       = pyramid + lod->level_offset[l];
+            size_t        below_count = lod->level_buckets[l - 1];
+            for (size_t k = 0; k < lod->level_buckets[l]; k++) {
+                const double* a = below + 4 * k;
+                /* fmin/fmax ignore a NaN operand, so empty halves drop out */
+                if (2 * k + 1 < below_count) {
+                    level[2 * k]     = fmin(a[0], a[2]);
+                    level[2 * k + 1] = fmax(a[1], a[3]);
+                } else {
+                    level[2 * k]     = a[0];
+                    level[2 * k + 1] = a[1];
+                }
+            }
+        }
+    }
+
+    return data;
+}
+
+/* Map an existing sidecar and check it still describes this .erg file */
+static int lod_map_valid(ERGLod* lod, const ERG* erg, const char* lod_path,
+                         const ERGLodSource* source) {
+    size_t size = 0;
+    void*  map  = map_whole_file(lod_path, &size);
+    if (!map) {
+        return -1;
+    }
+
+    const ERGLodHeader* header = (const ERGLodHeader*)map;
+    if (size < sizeof(ERGLodHeader) ||
+        memcmp(header->magic, ERG_LOD_MAGIC, sizeof(header->magic)) != 0 ||
+        header->erg_size != source->erg_size || header->erg_mtime != source->erg_mtime ||
+        header->info_size != source->info_size || header->info_mtime != source->info_mtime ||
+        header->signal_count != erg->signal_count || header->sample_count != erg->sample_count ||
+        header->row_size != erg->row_size || header->base_bucket != ERG_LOD_BASE_BUCKET) {
+        unmap_whole_file(map, size);
+        return -1;
+    }
+
+    lod_layout(lod, erg->signal_count, erg->sample_count, ERG_LOD_BASE_BUCKET);
+    size_t expected = sizeof(ERGLodHeader) + lod->signal_count * lod->signal_stride * sizeof(double);
+    if (header->level_count != lod->level_count || size != expected) {
+        unmap_whole_file(map, size);
+        return -1;
+    }
+
+    lod->mapped_data = map;
+    lod->mapped_size = size;
+    lod->data        = (const double*)((const uint8_t*)map + sizeof(ERGLodHeader));
+    return 0;
+}
+
+/* Write header and pyramid to <lod_path>.tmp, then rename into place */
+static int lod_write(const char* lod_path, const ERGLod* lod, const double* data,
+                     const ERG* erg, const ERGLodSource* source) {
+    size_t tmp_len  = strlen(lod_path) + 5;
+    char*  tmp_path = malloc(tmp_len);
+    if (!tmp_path) {
+        fprintf(stderr, "FATAL: Failed to allocate path buffer (%zu bytes)\n", tmp_len);
+        exit(1);
+    }
+    snprintf(tmp_path, tmp_len, "%s.tmp", lod_path);
+
+    ERGLodHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ERG_LOD_MAGIC, sizeof(header.magic));
+    header.erg_size     = source->erg_size;
+    header.erg_mtime    = source->erg_mtime;
+    header.info_size    = source->info_size;
+    header.info_mtime   = source->info_mtime;
+    header.signal_count = erg->signal_count;
+    header.sample_count = erg->sample_count;
+    header.row_size     = erg->row_size;
+    header.base_bucket  = lod->base_bucket;
+    header.level_count  = lod->level_count;
+
+    size_t count = lod->signal_count * lod->signal_stride;
+    FILE*  fp    = fopen(tmp_path, "wb");
+    int    ok    = fp != NULL;
+    if (ok) {
+        ok = fwrite(&header, sizeof(header), 1, fp) == 1 &&
+             fwrite(data, sizeof(double), count, fp) == count;
+        ok = (fclose(fp) == 0) && ok;
+    }
+    if (ok) {
+        remove(lod_path); /* rename() does not replace on Windows */
+        ok = rename(tmp_path, lod_path) == 0;
+    }
+    if (!ok) {
+        fprintf(stderr, "WARNING: Failed to write LOD sidecar '%s'\n", lod_path);
+        remove(tmp_path);
+    }
+
+    free(tmp_path);
+    return ok ? 0 : -1;
+}
+
+int erg_lod_open(ERGLod* lod, const ERG* erg, int build_if_stale) {
+    memset(lod, 0, sizeof(ERGLod));
+
+    if (erg->sample_count == 0) {
+        return -1;
+    }
+
+    size_t path_len = strlen(erg->erg_path) + 6; /* +".info", also fits ".lod" */
+    char*  lod_path = malloc(path_len);
+    if (!lod_path) {
+        fprintf(stderr, "FATAL: Failed to allocate path buffer (%zu bytes)\n", path_len);
+        exit(1);
+    }
+
+    ERGLodSource source;
+    snprintf(lod_path, path_len, "%s.info", erg->erg_path);
+    if (file_identity(erg->erg_path, &source.erg_size, &source.erg_mtime) != 0 ||
+        file_identity(lod_path, &source.info_size, &source.info_mtime) != 0) {
+        free(lod_path);
+        return -1;
+    }
+    snprintf(lod_path, path_len, "%s.lod", erg->erg_path);
+
+    if (lod_map_valid(lod, erg, lod_path, &source) == 0) {
+        free(lod_path);
+        return 0;
+    }
+    if (!build_if_stale) {
+        free(lod_path);
+        return -1;
+    }
+
+    /* Missing or stale: rebuild, persist, and serve from the new mapping.
+     * If the sidecar cannot be written, keep the pyramid in memory. */
+    lod_layout(lod, erg->signal_count, erg->sample_count, ERG_LOD_BASE_BUCKET);
+    double* data = lod_build_pyramid(erg, lod);
+    if (lod_write(lod_path, lod, data, erg, &source) == 0 &&
+        lod_map_valid(lod, erg, lod_path, &source) == 0) {
+        free(data);
+    } else {
+        lod->data       = data;
+        lod->owned_data = data;
+    }
+
+    free(lod_path);
+    return 0;
+}
+
+/* Scaled min/max over samples [a, b) from the coarsest aligned buckets,
+ * with raw samples only for the unaligned edges */
+static void lod_range_minmax(const ERGLod* lod, const ERG* erg, size_t index, size_t a, size_t b,
+                             double* out_min, double* out_max) {
+    const ERGSignal* sig     = &erg->signals[index];
+    const double*    pyramid = lod->data + index * lod->signal_stride;
+    size_t           base    = lod->base_bucket;
+    double           mn      = INFINITY;
+    double           mx      = -INFINITY;
+
+    size_t pos = a;
+    while (pos < b) {
+        double lo, hi;
+        size_t next;
+
+        if (pos % base != 0 || (pos + base > b && b < lod->sample_count)) {
+            /* Unaligned edge: read raw samples up to the next bucket boundary */
+            next = (pos / base + 1) * base;
+            if (next > b)
+                next = b;
+            signal_window_minmax(erg, sig, pos, next - pos, &lo, &hi);
+        } else {
+            /* Coarsest level whose bucket starts here and ends inside the range
+             * (the last bucket of a level may be short at the end of the data) */
+            size_t level = 0;
+            while (level + 1 < lod->level_count) {
+                size_t size = base << (level + 1);
+                size_t end  = pos + size < lod->sample_count ? pos + size : lod->sample_count;
+                if (pos % size != 0 || end > b)
+                    break;
+                level++;
+            }
+            size_t        size   = base << level;
+            const double* bucket = pyramid + lod->level_offset[level] + 2 * (pos / size);
+            lo                   = bucket[0];
+            hi                   = bucket[1];
+            next                 = pos + size < lod->sample_count ? pos + size : lod->sample_count;
+        }
+
+        /* Comparisons with NaN are false, so all-NaN pieces drop out */
+        if (lo < mn)
+            mn = lo;
+        if (hi > mx)
+            mx = hi;
+        pos = next;
+    }
+
+    if (mn > mx) {
+        mn = NAN;
+        mx = NAN;
+    }
+    *out_min = mn;
+    *out_max = mx;
+}
+
+size_t erg_lod_query(const ERGLod* lod, const ERG* erg, size_t index, size_t first_sample,
+                     size_t count, size_t bucket_count, ERGBucket* out) {
+    if (!lod->data || lod->signal_count != erg->signal_count || lod->sample_count != erg->sample_count) {
+        return 0;
+    }
+    bucket_count = clamp_minmax_request(erg, index, first_sample, &count, bucket_count);
+    if (bucket_count == 0) {
+        return 0;
+    }
+
+    const ERGSignal* sig = &erg->signals[index];
+    for (size_t b = 0; b < bucket_count; b++) {
+        /* Same bucket boundaries as erg_get_signal_minmax() */
+        size_t start = first_sample + (size_t)((uint64_t)b * count / bucket_count);
+        size_t end   = first_sample + (size_t)((uint64_t)(b + 1) * count / bucket_count);
+
+        ERGBucket* bucket = &out[b];
+        lod_range_minmax(lod, erg, index, start, end, &bucket->min, &bucket->max);
+        bucket->first = read_sample_as_double(erg, sig, start);
+        bucket->last  = read_sample_as_double(erg, sig, end - 1);
+    }
+
+    return bucket_count;
+}
+
+void erg_lod_close(ERGLod* lod) {
+    if (lod->mapped_data) {
+        unmap_whole_file(lod->mapped_data, lod->mapped_size);
+    }
+    free(lod->owned_data);
+    memset(lod, 0, sizeof(ERGLod));
+}
+
+/* ============================================================================
+ * OPEN INDEX SIDECAR
+ * <file>.erg.idx caches the resolved schema (signal records and a string
+ * table of names and units), the data layout, the Time index and optional
+ * per-signal statistics, so a reopen is a few stats plus one mapping.
+ * ============================================================================ */
+
+#define ERG_IDX_MAGIC "ERGIDX2"
+
+/* On-disk header, followed by signal_count ERGIndexSignal records,
+ * signal_count ERGIndexStats records if has_stats, and the string table */
+typedef struct {
+    char     magic[8];
+    uint64_t erg_size;      /* Size of the .erg file the cache was built from */
+    int64_t  erg_mtime;     /* Modification time of that .erg file (see file_identity) */
+    uint64_t info_size;     /* Size of the .erg.info file */
+    int64_t  info_mtime;    /* Modification time of the .erg.info file */
+    uint64_t signal_count;
+    uint64_t sample_count;
+    uint64_t row_size;
+    uint64_t data_offset;
+    uint64_t strings_size;  /* Bytes in the string table */
+    uint64_t has_stats;     /* 1 if statistics records are present */
+    uint64_t time_signal;   /* Time index signal + 1 (0 = no Time index) */
+    uint64_t time_samples;
+    double   time_first;
+    double   time_last;
+    double   time_step;
+    uint64_t time_uniform;
+} ERGIndexHeader;
+
+typedef struct {
+    uint64_t name;          /* Offset of the name in the string table */
+    uint64_t unit;          /* Offset of the unit in the string table */
+    uint64_t type;          /* ERGDataType */
+    uint64_t type_size;
+    uint64_t row_offset;
+    double   factor;
+    double   offset;
+} ERGIndexSignal;
+
+typedef struct {
+    double   min;
+    double   max;
+    double   mean;
+    double   variance;
+    uint64_t count;
+    uint64_t nan_count;
+    uint64_t inf_count;
+    double   first;
+    double   last;
+} ERGIndexStats;
+
+/* Allocate "<erg_path><suffix>" in the metadata arena */
+static char* sidecar_path(ERG* erg, const char* suffix) {
+    size_t len  = strlen(erg->erg_path) + strlen(suffix) + 1;
+    char*  path = arena_alloc(&erg->metadata_arena, len);
+    snprintf(path, len, "%s%s", erg->erg_path, suffix);
+    return path;
+}
+
+/* Validate a mapped cache against the current files; returns the header or NULL */
+static const ERGIndexHeader* index_validate(const void* map, size_t size, uint64_t erg_size, int64_t erg_mtime,
+                                            uint64_t info_size, int64_t info_mtime) {
+    const ERGIndexHeader* header = (const ERGIndexHeader*)map;
+    if (size < sizeof(ERGIndexHeader) ||
+        memcmp(header->magic, ERG_IDX_MAGIC, sizeof(header->magic)) != 0 ||
+        header->erg_size != erg_size || header->erg_mtime != erg_mtime ||
+        header->info_size != info_size || header->info_mtime != info_mtime ||
+        header->signal_count == 0 || header->signal_count > UINT32_MAX || header->strings_size == 0) {
+        return NULL;
+    }
+
+    uint64_t records  = header->signal_count * sizeof(ERGIndexSignal);
+    uint64_t stats    = header->has_stats ? header->signal_count * sizeof(ERGIndexStats) : 0;
+    uint64_t expected = sizeof(ERGIndexHeader) + records + stats + header->strings_size;
+    if (size != expected) {
+        return NULL;
+    }
+
+    const ERGIndexSignal* signals = (const ERGIndexSignal*)(header + 1);
+    const char*           strings = (const char*)map + expected - header->strings_size;
+    if (strings[header->strings_size - 1] != '\0') {
+        return NULL;
+    }
+    for (uint64_t i = 0; i < header->signal_count; i++) {
+        if (signals[i].name >= header->strings_size || signals[i].unit >= header->strings_size ||
+            signals[i].type > ERG_UNKNOWN || signals[i].type_size == 0 || signals[i].type_size > 8 ||
+            signals[i].row_offset + signals[i].type_size > header->row_size) {
+            return NULL;
+        }
+    }
+    return header;
+}
+
+static int index_load(ERG* erg) {
+    uint64_t erg_size, info_size;
+    int64_t  erg_mtime, info_mtime;
+    if (file_identity(erg->erg_path, &erg_size, &erg_mtime) != 0 ||
+        file_identity(sidecar_path(erg, ".info"), &info_size, &info_mtime) != 0) {
+        return -1;
+    }
+
+    size_t size = 0;
+    void*  map  = map_whole_file(sidecar_path(erg, ".idx"), &size);
+    if (!map) {
+        return -1;
+    }
+    const ERGIndexHeader* header = index_validate(map, size, erg_size, erg_mtime, info_size, info_mtime);
+    if (!header) {
+        unmap_whole_file(map, size);
+        return -1;
+    }
+
+    const ERGIndexSignal* records = (const ERGIndexSignal*)(header + 1);
+    const ERGIndexStats*  stats   = (const ERGIndexStats*)(records + header->signal_count);
+    const char*           strings = (const char*)map + size - header->strings_size;
+
+    /* Signal records point straight into the mapping */
+    erg->signal_count = (size_t)header->signal_count;
+    erg->signals      = calloc(erg->signal_count, sizeof(ERGSignal));
+    if (!erg->signals) {
+        fprintf(stderr, "FATAL: Failed to allocate signals array (%zu bytes)\n",
+                erg->signal_count * sizeof(ERGSignal));
+        exit(1);
+    }
+    for (size_t i = 0; i < erg->signal_count; i++) {
+        ERGSignal* sig  = &erg->signals[i];
+        sig->name       = (char*)strings + records[i].name;
+        sig->unit       = (char*)strings + records[i].unit;
+        sig->type       = (ERGDataType)records[i].type;
+        sig->type_size  = (size_t)records[i].type_size;
+        sig->row_offset = (size_t)records[i].row_offset;
+        sig->factor     = records[i].factor;
+        sig->offset     = records[i].offset;
+    }
+    erg->row_size      = (size_t)header->row_size;
+    erg->little_endian = 1;
+    build_signal_index(erg);
+    set_data_layout(erg, (size_t)erg_size);
+
+    if (header->time_signal > 0 && header->time_signal <= header->signal_count) {
+        erg->time_index.signal_index = (size_t)header->time_signal - 1;
+        erg->time_index.sample_count = (size_t)header->time_samples;
+        erg->time_index.first        = header->time_first;
+        erg->time_index.last         = header->time_last;
+        erg->time_index.step         = header->time_step;
+        erg->time_index.uniform      = (int)header->time_uniform;
+        erg->time_index.hint         = 0;
+    }
+
+    if (header->has_stats) {
+        erg->cached_stats = malloc(erg->signal_count * sizeof(ERGStats));
+        if (!erg->cached_stats) {
+            fprintf(stderr, "FATAL: Failed to allocate cached statistics\n");
+            exit(1);
+        }
+        for (size_t i = 0; i < erg->signal_count; i++) {
+            ERGStats* out  = &erg->cached_stats[i];
+            out->min       = stats[i].min;
+            out->max       = stats[i].max;
+            out->mean      = stats[i].mean;
+            out->variance  = stats[i].variance;
+            out->count     = (size_t)stats[i].count;
+            out->nan_count = (size_t)stats[i].nan_count;
+            out->inf_count = (size_t)stats[i].inf_count;
+            out->first     = stats[i].first;
+            out->last      = stats[i].last;
+        }
+    }
+
+    /* The .erg.info was not parsed (erg_init() only allocated the struct) */
+    free(erg->info);
+    erg->info = NULL;
+
+    erg->index_data = map;
+    erg->index_size = size;
+    return 0;
+}
+
+/* Write the cache for a freshly parsed file to <idx>.tmp, then rename into place */
+static void index_write(ERG* erg) {
+    uint64_t erg_size, info_size;
+    int64_t  erg_mtime, info_mtime;
+    if (file_identity(erg->erg_path, &erg_size, &erg_mtime) != 0 ||
+        file_identity(sidecar_path(erg, ".info"), &info_size, &info_mtime) != 0) {
+        return;
+    }
+
+    ERGIndexHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ERG_IDX_MAGIC, sizeof(header.magic));
+    header.erg_size     = erg_size;
+    header.erg_mtime    = erg_mtime;
+    header.info_size    = info_size;
+    header.info_mtime   = info_mtime;
+    header.signal_count = erg->signal_count;
+    header.sample_count = erg->sample_count;
+    header.row_size     = erg->row_size;
+    header.data_offset  = erg->data_offset;
+    if (erg->time_index.sample_count > 0) {
+        header.time_signal  = erg->time_index.signal_index + 1;
+        header.time_samples = erg->time_index.sample_count;
+        header.time_first   = erg->time_index.first;
+        header.time_last    = erg->time_index.last;
+        header.time_step    = erg->time_index.step;
+        header.time_uniform = (uint64_t)erg->time_index.uniform;
+    }
+
+    /* Signal records and string table */
+    ERGIndexSignal* records = calloc(erg->signal_count, sizeof(ERGIndexSignal));
+    if (!records) {
+        fprintf(stderr, "FATAL: Failed to allocate index records\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < erg->signal_count; i++) {
+        const ERGSignal* sig  = &erg->signals[i];
+        records[i].name       = header.strings_size;
+        header.strings_size  += strlen(sig->name) + 1;
+        records[i].unit       = header.strings_size;
+        header.strings_size  += strlen(sig->unit) + 1;
+        records[i].type       = (uint64_t)sig->type;
+        records[i].type_size  = sig->type_size;
+        records[i].row_offset = sig->row_offset;
+        records[i].factor     = sig->factor;
+        records[i].offset     = sig->offset;
+    }
+
+    /* Statistics cost a full scan: only on request, and kept for this handle */
+    ERGIndexStats* stats = NULL;
+    if (erg->open_options.index_stats && erg->sample_count > 0) {
+        erg->cached_stats = malloc(erg->signal_count * sizeof(ERGStats));
+        stats             = calloc(erg->signal_count, sizeof(ERGIndexStats));
+        if (!erg->cached_stats || !stats) {
+            fprintf(stderr, "FATAL: Failed to allocate index statistics\n");
+            exit(1);
+        }
+        erg_compute_stats(erg, NULL, 0, erg->cached_stats);
+        for (size_t i = 0; i < erg->signal_count; i++) {
+            const ERGStats* in  = &erg->cached_stats[i];
+            stats[i].min       = in->min;
+            stats[i].max       = in->max;
+            stats[i].mean      = in->mean;
+            stats[i].variance  = in->variance;
+            stats[i].count     = in->count;
+            stats[i].nan_count = in->nan_count;
+            stats[i].inf_count = in->inf_count;
+            stats[i].first     = in->first;
+            stats[i].last      = in->last;
+        }
+        header.has_stats = 1;
+    }
+
+    const char* idx_path = sidecar_path(erg, ".idx");
+    const char* tmp_path = sidecar_path(erg, ".idx.tmp");
+    FILE*       fp       = fopen(tmp_path, "wb");
+    int         ok       = fp != NULL;
+    if (ok) {
+        ok = fwrite(&header, sizeof(header), 1, fp) == 1 &&
+             fwrite(records, sizeof(ERGIndexSignal), erg->signal_count, fp) == erg->signal_count &&
+             (!stats || fwrite(stats, sizeof(ERGIndexStats), erg->signal_count, fp) == erg->signal_count);
+        for (size_t i = 0; ok && i < erg->signal_count; i++) {
+            const ERGSignal* sig = &erg->signals[i];
+            ok = fwrite(sig->name, 1, strlen(sig->name) + 1, fp) == strlen(sig->name) + 1 &&
+                 fwrite(sig->unit, 1, strlen(sig->unit) + 1, fp) == strlen(sig->unit) + 1;
+        }
+        ok = (fclose(fp) == 0) && ok;
+    }
+    if (ok) {
+        remove(idx_path); /* rename() does not replace on Windows */
+        ok = rename(tmp_path, idx_path) == 0;
+    }
+    if (!ok) {
+        fprintf(stderr, "WARNING: Failed to write index sidecar '%s'\n", idx_path);
+        remove(tmp_path);
+    }
+
+    free(stats);
+    free(records);
+}
+
+int erg_get_cached_stats(const ERG* erg, size_t index, ERGStats* out) {
+    if (!erg->cached_stats || index >= erg->signal_count) {
+        return -1;
+    }
+    *out = erg->cached_stats[index];
+    return 0;
+}
+
+void erg_free(ERG* erg) {
+    if (!erg)
+        return;
+
+    /* Free data read by erg_open_async() */
+    if (erg->read_buffer) {
+        free_read_buffer(erg->read_buffer);
+        erg->read_buffer = NULL;
+        erg->mapped_data = NULL;
+        erg->mapped_size = 0;
+    }
+
+    /* Unmap memory-mapped file */
+    if (erg->mapped_data) {
+#ifdef _WIN32
+        UnmapViewOfFile(erg->mapped_data);
+        erg->mapped_data = NULL;
+
+        if (erg->mapping_handle) {
+            CloseHandle(erg->mapping_handle);
+            erg->mapping_handle = NULL;
+        }
+
+        if (erg->file_handle != INVALID_HANDLE_VALUE) {
+            CloseHandle(erg->file_handle);
+            erg->file_handle = INVALID_HANDLE_VALUE;
+        }
+#else
+        munmap(erg->mapped_data, erg->mapped_size);
+        erg->mapped_data = NULL;
+
+        if (erg->file_descriptor != -1) {
+            close(erg->file_descriptor);
+            erg->file_descriptor = -1;
+        }
+#endif
+        erg->mapped_size = 0;
+    }
+
+    /* Free columnar copy of the data */
+    if (erg->columnar_data) {
+        free(erg->columnar_data);
+        erg->columnar_data = NULL;
+    }
+
+    /* Free arena - this frees erg_path, all signal names, and all units in one call! */
+    arena_free(&erg->metadata_arena);
+
+    /* Free signal name index */
+    if (erg->signal_slots) {
+        free(erg->signal_slots);
+        erg->signal_slots = NULL;
+    }
+
+    /* Release the schema cache (signal names and units may point into it) */
+    if (erg->index_data) {
+        unmap_whole_file(erg->index_data, erg->index_size);
+        erg->index_data = NULL;
+        erg->index_size = 0;
+    }
+    free(erg->cached_stats);
+    erg->cached_stats = NULL;
 
     /* Free signals array (the ERGSignal structs themselves, not the strings) */
     if (erg->signals) {
@@ -1,13 +1,26 @@
 #include <arena.h>
+#include <cpu_dispatch.h>
 #include <ctype.h>
-#include <immintrin.h> // AVX2 intrinsics
+#include <locale.h>
+#include <immintrin.h> // SSE4.2 / AVX2 / AVX-512 intrinsics (per-function targets)
 #include <infofile.h>
+#include <parallel.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #define INITIAL_CAPACITY   64
+#define INITIAL_SLOTS      128  // Hash index slots (load factor <= 0.5)
 #define INITIAL_ARENA_SIZE (256 * 1024) // 256KB initial arena
 
 /* ============================================================================
@@ -31,6 +44,18 @@ void infofile_init(InfoFile* info) {
     }
     info->count    = 0;
     info->capacity = INITIAL_CAPACITY;
+    info->slots    = calloc(INITIAL_SLOTS, sizeof(InfoFileSlot));
+    if (!info->slots) {
+        fprintf(stderr, "FATAL: Failed to allocate key index (%zu bytes)\n",
+                INITIAL_SLOTS * sizeof(InfoFileSlot));
+        exit(1);
+    }
+    info->slot_mask    = INITIAL_SLOTS - 1;
+    info->slot_used    = 0;
+    info->sorted       = NULL;
+    info->sorted_count = 0;
+    info->mapped_data  = NULL;
+    info->mapped_size  = 0;
     arena_init(&info->arena.key_arena, INITIAL_ARENA_SIZE);
     arena_init(&info->arena.value_arena, INITIAL_ARENA_SIZE);
 }
@@ -50,91 +75,536 @@ static void ensure_capacity(InfoFile* info) {
 }
 
 /* ============================================================================
- * SIMD Helper: Find newline character using AVX2
+ * OPTIMIZATION 5: Hash Index
+ * Open addressing over a hot slot array holding hash, key length and entry
+ * index; only a matching hash and length leads to a memcmp of the key
  * ============================================================================ */
-static inline const char* simd_find_newline_opt(const char* ptr, const char* end) {
-    size_t len = end - ptr;
 
-    if (len >= 32) {
-        __m256i newline_vec = _mm256_set1_epi8('\n');
+static inline uint32_t hash_key(const char* key, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)key[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
 
-        while (ptr + 32 <= end) {
-            __m256i data = _mm256_loadu_si256((const __m256i*)ptr);
-            __m256i cmp  = _mm256_cmpeq_epi8(data, newline_vec);
-            int     mask = _mm256_movemask_epi8(cmp);
+/* Probe for key; returns its slot or the empty slot where it would go */
+static inline InfoFileSlot* find_slot(const InfoFile* info, const char* key, size_t len,
+                                      uint32_t hash) {
+    size_t slot = hash & info->slot_mask;
+    for (;;) {
+        InfoFileSlot* entry = &info->slots[slot];
+        if (entry->index == 0)
+            return entry;
+        if (entry->hash == hash && entry->key_len == len &&
+            memcmp(info->entries[entry->index - 1].key, key, len) == 0)
+            return entry;
+        slot = (slot + 1) & info->slot_mask;
+    }
+}
 
-            if (mask != 0) {
-                int offset = __builtin_ctz(mask);
-                return ptr + offset;
-            }
-            ptr += 32;
+/* Grow the slot array so that `needed` keys stay at load factor <= 0.5 */
+static void reserve_slots(InfoFile* info, size_t needed) {
+    size_t slot_count = info->slot_mask + 1;
+    if (needed * 2 <= slot_count)
+        return;
+    while (slot_count < needed * 2)
+        slot_count *= 2;
+
+    InfoFileSlot* old_slots = info->slots;
+    size_t        old_count = info->slot_mask + 1;
+    info->slots             = calloc(slot_count, sizeof(InfoFileSlot));
+    if (!info->slots) {
+        fprintf(stderr, "FATAL: Failed to allocate key index (%zu bytes)\n",
+                slot_count * sizeof(InfoFileSlot));
+        exit(1);
+    }
+    info->slot_mask = slot_count - 1;
+
+    for (size_t i = 0; i < old_count; i++) {
+        if (old_slots[i].index != 0) {
+            size_t slot = old_slots[i].hash & info->slot_mask;
+            while (info->slots[slot].index != 0)
+                slot = (slot + 1) & info->slot_mask;
+            info->slots[slot] = old_slots[i];
         }
     }
+    free(old_slots);
+}
 
-    // Scalar fallback
-    while (ptr < end) {
-        if (*ptr == '\n') {
-            return ptr;
-        }
-        ptr++;
+/* Index entry pos unless an earlier entry already has its key */
+static void index_entry(InfoFile* info, size_t pos, uint32_t hash) {
+    const InfoFileEntry* entry = &info->entries[pos];
+    reserve_slots(info, info->slot_used + 1);
+    InfoFileSlot* slot = find_slot(info, entry->key, entry->key_len, hash);
+    if (slot->index == 0) {
+        slot->hash    = hash;
+        slot->key_len = entry->key_len;
+        slot->index   = (uint32_t)(pos + 1);
+        info->slot_used++;
     }
+}
 
-    return NULL;
+/* Append an entry; files without a key index (parallel chunks) skip hashing */
+static void add_entry(InfoFile* info, const char* key, size_t key_len, const char* value,
+                      size_t value_len) {
+    ensure_capacity(info);
+    InfoFileEntry* entry = &info->entries[info->count++];
+    entry->key           = key;
+    entry->value         = value;
+    entry->key_len       = (uint32_t)key_len;
+    entry->value_len     = (uint32_t)value_len;
+
+    if (info->slots)
+        index_entry(info, info->count - 1, hash_key(key, key_len));
 }
 
 /* ============================================================================
- * OPTIMIZATION 2: SIMD Whitespace Trimming
- * Use AVX2 to detect whitespace 32 bytes at a time
+ * OPTIMIZATION 6: Sorted Key Index
+ * Entry indices kept in key order for prefix and subtree queries. '.' ranks
+ * just above the terminator, so "A.B" < "A.B.C" < "A.B-C" and every subtree
+ * is one contiguous run.
  * ============================================================================ */
 
-static inline const char* simd_skip_leading_whitespace(const char* str, const char* end) {
-    size_t len = end - str;
-
-    if (len >= 32) {
-        __m256i space = _mm256_set1_epi8(' ');
-        __m256i tab   = _mm256_set1_epi8('\t');
-        __m256i cr    = _mm256_set1_epi8('\r');
-        __m256i nl    = _mm256_set1_epi8('\n');
-
-        const char* ptr = str;
-        while (ptr + 32 <= end) {
-            __m256i data = _mm256_loadu_si256((const __m256i*)ptr);
-
-            // Check if any byte is NOT whitespace
-            __m256i cmp_space = _mm256_cmpeq_epi8(data, space);
-            __m256i cmp_tab   = _mm256_cmpeq_epi8(data, tab);
-            __m256i cmp_cr    = _mm256_cmpeq_epi8(data, cr);
-            __m256i cmp_nl    = _mm256_cmpeq_epi8(data, nl);
-
-            // OR all whitespace comparisons
-            __m256i is_ws1        = _mm256_or_si256(cmp_space, cmp_tab);
-            __m256i is_ws2        = _mm256_or_si256(cmp_cr, cmp_nl);
-            __m256i is_whitespace = _mm256_or_si256(is_ws1, is_ws2);
-
-            int mask = _mm256_movemask_epi8(is_whitespace);
-
-            // If not all whitespace, find first non-whitespace
-            if (mask != 0xFFFFFFFF) {
-                // Invert mask to find non-whitespace
-                int non_ws_mask = ~mask;
-                if (non_ws_mask != 0) {
-                    int offset = __builtin_ctz(non_ws_mask);
-                    return ptr + offset;
-                }
-            }
+static inline unsigned key_rank(char c) {
+    unsigned char u = (unsigned char)c;
+    if (u == '.')
+        return 1;
+    return (u != 0 && u < '.') ? u + 1u : u;
+}
 
-            ptr += 32;
-        }
+/* Keys are compared by length, never by terminator: mapped keys have none */
+static inline int key_order(const InfoFileEntry* a, const InfoFileEntry* b) {
+    size_t n = a->key_len < b->key_len ? a->key_len : b->key_len;
+    for (size_t i = 0; i < n; i++) {
+        if (a->key[i] != b->key[i])
+            return (int)key_rank(a->key[i]) - (int)key_rank(b->key[i]);
+    }
+    return (int)(a->key_len > n) - (int)(b->key_len > n);
+}
+
+/* <0, 0 or >0 as the key sorts before, starts with, or sorts after prefix */
+static inline int prefix_order(const InfoFileEntry* entry, const char* prefix, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (i == entry->key_len)
+            return -1;
+        if (entry->key[i] != prefix[i])
+            return (int)key_rank(entry->key[i]) - (int)key_rank(prefix[i]);
+    }
+    return 0;
+}
+
+/* Merge sorted runs a[0..na) and b[0..nb) into out (stable) */
+static void merge_runs(const InfoFile* info, const uint32_t* a, size_t na, const uint32_t* b,
+                       size_t nb, uint32_t* out) {
+    size_t i = 0, j = 0, k = 0;
+    while (i < na && j < nb) {
+        if (key_order(&info->entries[b[j]], &info->entries[a[i]]) < 0)
+            out[k++] = b[j++];
+        else
+            out[k++] = a[i++];
+    }
+    while (i < na)
+        out[k++] = a[i++];
+    while (j < nb)
+        out[k++] = b[j++];
+}
+
+/* Stable merge sort of idx[0..n) by key; tmp holds n scratch slots */
+static void sort_keys(const InfoFile* info, uint32_t* idx, uint32_t* tmp, size_t n) {
+    if (n < 2)
+        return;
+    size_t half = n / 2;
+    sort_keys(info, idx, tmp, half);
+    sort_keys(info, idx + half, tmp, n - half);
+    if (key_order(&info->entries[idx[half]], &info->entries[idx[half - 1]]) >= 0)
+        return; /* Already in order, common for generated files */
+    memcpy(tmp, idx, half * sizeof(uint32_t));
+    merge_runs(info, tmp, half, idx + half, n - half, idx);
+}
+
+/* Bring the sorted index up to date with entries appended by the last parse */
+static void update_sorted_index(InfoFile* info) {
+    size_t old_count = info->sorted_count;
+    size_t count     = info->count;
+    if (old_count == count)
+        return;
+
+    uint32_t* sorted = realloc(info->sorted, count * sizeof(uint32_t));
+    uint32_t* tmp    = malloc(count * sizeof(uint32_t));
+    if (!sorted || !tmp) {
+        fprintf(stderr, "FATAL: Failed to allocate sorted key index (%zu bytes)\n",
+                count * sizeof(uint32_t));
+        exit(1);
+    }
+    info->sorted = sorted;
+
+    for (size_t i = old_count; i < count; i++)
+        sorted[i] = (uint32_t)i;
+    sort_keys(info, sorted + old_count, tmp, count - old_count);
+    if (old_count > 0) {
+        memcpy(tmp, sorted, old_count * sizeof(uint32_t));
+        merge_runs(info, tmp, old_count, sorted + old_count, count - old_count, sorted);
+    }
+    free(tmp);
+    info->sorted_count = count;
+}
+
+/* First sorted position in [lo, hi) whose key does not sort before prefix
+ * (upper = 0) or sorts after it (upper = 1) */
+static size_t prefix_bound(const InfoFile* info, const char* prefix, size_t len, size_t lo,
+                           size_t hi, int upper) {
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        int    cmp = prefix_order(&info->entries[info->sorted[mid]], prefix, len);
+        if (cmp < 0 || (upper && cmp == 0))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/* First sorted position in [lo, hi) past key[0..len) and its "key." subtree */
+static size_t subtree_end(const InfoFile* info, const char* key, size_t len, size_t lo,
+                          size_t hi) {
+    while (lo < hi) {
+        size_t               mid       = lo + (hi - lo) / 2;
+        const InfoFileEntry* candidate = &info->entries[info->sorted[mid]];
+        int                  cmp       = prefix_order(candidate, key, len);
+        if (cmp < 0 || (cmp == 0 && (candidate->key_len == len || candidate->key[len] == '.')))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/* ============================================================================
+ * SIMD Helpers: byte-class scans in scalar, SSE4.2, AVX2 and AVX-512 variants
+ * One table per level, indexed by cpu_simd_level() on every call. SSE4.2
+ * uses the PCMPESTRI/PCMPESTRM string instructions with a byte set; the
+ * wider variants OR together one compare per character.
+ * ============================================================================ */
+
+static inline bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static inline bool is_separator(char c) {
+    return c == '=' || c == ':' || c == '#';
+}
+
+/* ---- Scalar ---- */
+
+static const char* find_newline_scalar(const char* ptr, const char* end) {
+    return memchr(ptr, '\n', (size_t)(end - ptr));
+}
+
+static const char* skip_whitespace_scalar(const char* ptr, const char* end) {
+    while (ptr < end && is_space(*ptr)) {
+        ptr++;
     }
+    return ptr;
+}
 
-    // Scalar fallback
-    const char* ptr = str;
-    while (ptr < end && (*ptr == ' ' || *ptr == '\t' || *ptr == '\r' || *ptr == '\n')) {
+static const char* find_separator_scalar(const char* ptr, const char* end) {
+    while (ptr < end && !is_separator(*ptr)) {
         ptr++;
     }
     return ptr;
 }
 
+static const char* find_whitespace_scalar(const char* ptr, const char* end) {
+    while (ptr < end && !is_space(*ptr)) {
+        ptr++;
+    }
+    return ptr;
+}
+
+/* Tokens are non-whitespace bytes whose predecessor is whitespace */
+static size_t count_tokens_scalar(const char* ptr, const char* end, bool prev_ws) {
+    size_t tokens = 0;
+    for (; ptr < end; ptr++) {
+        bool ws = is_space(*ptr);
+        tokens += !ws && prev_ws;
+        prev_ws = ws;
+    }
+    return tokens;
+}
+
+static size_t count_tokens_start(const char* ptr, const char* end) {
+    return count_tokens_scalar(ptr, end, true);
+}
+
+/* ---- SSE4.2 ---- */
+
+#define SSE42_ANY      (_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT)
+#define SSE42_NOT_ANY  (SSE42_ANY | _SIDD_NEGATIVE_POLARITY)
+
+CPU_TARGET_SSE42 static const char* find_newline_sse42(const char* ptr, const char* end) {
+    __m128i newline = _mm_set1_epi8('\n');
+    while (end - ptr >= 16) {
+        __m128i data = _mm_loadu_si128((const __m128i*)ptr);
+        int     mask = _mm_movemask_epi8(_mm_cmpeq_epi8(data, newline));
+        if (mask != 0)
+            return ptr + __builtin_ctz(mask);
+        ptr += 16;
+    }
+    while (ptr < end) {
+        if (*ptr == '\n')
+            return ptr;
+        ptr++;
+    }
+    return NULL;
+}
+
+CPU_TARGET_SSE42 static const char* skip_whitespace_sse42(const char* ptr, const char* end) {
+    const __m128i set = _mm_setr_epi8(' ', '\t', '\r', '\n', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    while (end - ptr >= 16) {
+        __m128i data  = _mm_loadu_si128((const __m128i*)ptr);
+        int     index = _mm_cmpestri(set, 4, data, 16, SSE42_NOT_ANY);
+        if (index < 16)
+            return ptr + index;
+        ptr += 16;
+    }
+    return skip_whitespace_scalar(ptr, end);
+}
+
+CPU_TARGET_SSE42 static const char* find_separator_sse42(const char* ptr, const char* end) {
+    const __m128i set = _mm_setr_epi8('=', ':', '#', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    while (end - ptr >= 16) {
+        __m128i data  = _mm_loadu_si128((const __m128i*)ptr);
+        int     index = _mm_cmpestri(set, 3, data, 16, SSE42_ANY);
+        if (index < 16)
+            return ptr + index;
+        ptr += 16;
+    }
+    return find_separator_scalar(ptr, end);
+}
+
+CPU_TARGET_SSE42 static const char* find_whitespace_sse42(const char* ptr, const char* end) {
+    const __m128i set = _mm_setr_epi8(' ', '\t', '\r', '\n', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    while (end - ptr >= 16) {
+        __m128i data  = _mm_loadu_si128((const __m128i*)ptr);
+        int     index = _mm_cmpestri(set, 4, data, 16, SSE42_ANY);
+        if (index < 16)
+            return ptr + index;
+        ptr += 16;
+    }
+    return find_whitespace_scalar(ptr, end);
+}
+
+CPU_TARGET_SSE42 static size_t count_tokens_sse42(const char* ptr, const char* end) {
+    const __m128i set     = _mm_setr_epi8(' ', '\t', '\r', '\n', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    uint32_t      prev_ws = 1;
+    size_t        tokens  = 0;
+    while (end - ptr >= 16) {
+        __m128i  data = _mm_loadu_si128((const __m128i*)ptr);
+        uint32_t mask = (uint32_t)_mm_cvtsi128_si32(_mm_cmpestrm(set, 4, data, 16, SSE42_ANY | _SIDD_BIT_MASK));
+        uint32_t starts = ~mask & ((mask << 1) | prev_ws) & 0xFFFF;
+        tokens += (size_t)_mm_popcnt_u32(starts);
+        prev_ws = (mask >> 15) & 1;
+        ptr += 16;
+    }
+    return tokens + count_tokens_scalar(ptr, end, prev_ws);
+}
+
+/* ---- AVX2 ---- */
+
+CPU_TARGET_AVX2 static inline uint32_t space_mask_avx2(__m256i data) {
+    __m256i ws = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(data, _mm256_set1_epi8(' ')),
+                                                 _mm256_cmpeq_epi8(data, _mm256_set1_epi8('\t'))),
+                                 _mm256_or_si256(_mm256_cmpeq_epi8(data, _mm256_set1_epi8('\r')),
+                                                 _mm256_cmpeq_epi8(data, _mm256_set1_epi8('\n'))));
+    return (uint32_t)_mm256_movemask_epi8(ws);
+}
+
+CPU_TARGET_AVX2 static const char* find_newline_avx2(const char* ptr, const char* end) {
+    __m256i newline = _mm256_set1_epi8('\n');
+    while (end - ptr >= 32) {
+        __m256i  data = _mm256_loadu_si256((const __m256i*)ptr);
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(data, newline));
+        if (mask != 0)
+            return ptr + __builtin_ctz(mask);
+        ptr += 32;
+    }
+    while (ptr < end) {
+        if (*ptr == '\n')
+            return ptr;
+        ptr++;
+    }
+    return NULL;
+}
+
+CPU_TARGET_AVX2 static const char* skip_whitespace_avx2(const char* ptr, const char* end) {
+    while (end - ptr >= 32) {
+        uint32_t mask = ~space_mask_avx2(_mm256_loadu_si256((const __m256i*)ptr));
+        if (mask != 0)
+            return ptr + __builtin_ctz(mask);
+        ptr += 32;
+    }
+    return skip_whitespace_scalar(ptr, end);
+}
+
+CPU_TARGET_AVX2 static const char* find_separator_avx2(const char* ptr, const char* end) {
+    __m256i equals = _mm256_set1_epi8('=');
+    __m256i colon  = _mm256_set1_epi8(':');
+    __m256i hash   = _mm256_set1_epi8('#');
+    while (end - ptr >= 32) {
+        __m256i  data = _mm256_loadu_si256((const __m256i*)ptr);
+        __m256i  any  = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(data, equals),
+                                                        _mm256_cmpeq_epi8(data, colon)),
+                                        _mm256_cmpeq_epi8(data, hash));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(any);
+        if (mask != 0)
+            return ptr + __builtin_ctz(mask);
+        ptr += 32;
+    }
+    return find_separator_scalar(ptr, end);
+}
+
+CPU_TARGET_AVX2 static const char* find_whitespace_avx2(const char* ptr, const char* end) {
+    while (end - ptr >= 32) {
+        uint32_t mask = space_mask_avx2(_mm256_loadu_si256((const __m256i*)ptr));
+        if (mask != 0)
+            return ptr + __builtin_ctz(mask);
+        ptr += 32;
+    }
+    return find_whitespace_scalar(ptr, end);
+}
+
+CPU_TARGET_AVX2 static size_t count_tokens_avx2(const char* ptr, const char* end) {
+    uint32_t prev_ws = 1;
+    size_t   tokens  = 0;
+    while (end - ptr >= 32) {
+        uint32_t mask   = space_mask_avx2(_mm256_loadu_si256((const __m256i*)ptr));
+        uint32_t starts = ~mask & ((mask << 1) | prev_ws);
+        tokens += (size_t)_mm_popcnt_u32(starts);
+        prev_ws = mask >> 31;
+        ptr += 32;
+    }
+    return tokens + count_tokens_scalar(ptr, end, prev_ws);
+}
+
+/* ---- AVX-512 ---- */
+
+CPU_TARGET_AVX512 static inline uint64_t space_mask_avx512(__m512i data) {
+    return _mm512_cmpeq_epi8_mask(data, _mm512_set1_epi8(' ')) |
+           _mm512_cmpeq_epi8_mask(data, _mm512_set1_epi8('\t')) |
+           _mm512_cmpeq_epi8_mask(data, _mm512_set1_epi8('\r')) |
+           _mm512_cmpeq_epi8_mask(data, _mm512_set1_epi8('\n'));
+}
+
+CPU_TARGET_AVX512 static const char* find_newline_avx512(const char* ptr, const char* end) {
+    __m512i newline = _mm512_set1_epi8('\n');
+    while (end - ptr >= 64) {
+        uint64_t mask = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512((const void*)ptr), newline);
+        if (mask != 0)
+            return ptr + __builtin_ctzll(mask);
+        ptr += 64;
+    }
+    return find_newline_avx2(ptr, end);
+}
+
+CPU_TARGET_AVX512 static const char* skip_whitespace_avx512(const char* ptr, const char* end) {
+    while (end - ptr >= 64) {
+        uint64_t mask = ~space_mask_avx512(_mm512_loadu_si512((const void*)ptr));
+        if (mask != 0)
+            return ptr + __builtin_ctzll(mask);
+        ptr += 64;
+    }
+    return skip_whitespace_avx2(ptr, end);
+}
+
+CPU_TARGET_AVX512 static const char* find_separator_avx512(const char* ptr, const char* end) {
+    __m512i equals = _mm512_set1_epi8('=');
+    __m512i colon  = _mm512_set1_epi8(':');
+    __m512i hash   = _mm512_set1_epi8('#');
+    while (end - ptr >= 64) {
+        __m512i  data = _mm512_loadu_si512((const void*)ptr);
+        uint64_t mask = _mm512_cmpeq_epi8_mask(data, equals) | _mm512_cmpeq_epi8_mask(data, colon) |
+                        _mm512_cmpeq_epi8_mask(data, hash);
+        if (mask != 0)
+            return ptr + __builtin_ctzll(mask);
+        ptr += 64;
+    }
+    return find_separator_avx2(ptr, end);
+}
+
+CPU_TARGET_AVX512 static const char* find_whitespace_avx512(const char* ptr, const char* end) {
+    while (end - ptr >= 64) {
+        uint64_t mask = space_mask_avx512(_mm512_loadu_si512((const void*)ptr));
+        if (mask != 0)
+            return ptr + __builtin_ctzll(mask);
+        ptr += 64;
+    }
+    return find_whitespace_avx2(ptr, end);
+}
+
+CPU_TARGET_AVX512 static size_t count_tokens_avx512(const char* ptr, const char* end) {
+    uint64_t prev_ws = 1;
+    size_t   tokens  = 0;
+    while (end - ptr >= 64) {
+        uint64_t mask   = space_mask_avx512(_mm512_loadu_si512((const void*)ptr));
+        uint64_t starts = ~mask & ((mask << 1) | prev_ws);
+        tokens += (size_t)_mm_popcnt_u64(starts);
+        prev_ws = mask >> 63;
+        ptr += 64;
+    }
+    return tokens + count_tokens_scalar(ptr, end, prev_ws != 0);
+}
+
+/* ---- Dispatch ---- */
+
+typedef struct {
+    const char* (*find_newline)(const char* ptr, const char* end);    /* NULL if none */
+    const char* (*skip_whitespace)(const char* ptr, const char* end); /* end if none */
+    const char* (*find_separator)(const char* ptr, const char* end);  /* First '=', ':' or '#' */
+    const char* (*find_whitespace)(const char* ptr, const char* end);
+    size_t (*count_tokens)(const char* ptr, const char* end);
+} ScanKernels;
+
+static const ScanKernels scan_kernels[CPU_SIMD_LEVELS] = {
+    {find_newline_scalar, skip_whitespace_scalar, find_separator_scalar, find_whitespace_scalar,
+     count_tokens_start},
+    {find_newline_sse42, skip_whitespace_sse42, find_separator_sse42, find_whitespace_sse42,
+     count_tokens_sse42},
+    {find_newline_avx2, skip_whitespace_avx2, find_separator_avx2, find_whitespace_avx2,
+     count_tokens_avx2},
+    {find_newline_avx512, skip_whitespace_avx512, find_separator_avx512, find_whitespace_avx512,
+     count_tokens_avx512},
+};
+
+static inline const ScanKernels* scan(void) {
+    return &scan_kernels[cpu_simd_level()];
+}
+
+/* Find newline character (NULL if none) */
+static inline const char* simd_find_newline_opt(const char* ptr, const char* end) {
+    return scan()->find_newline(ptr, end);
+}
+
+/* First whitespace byte in [ptr, end), or end */
+static inline const char* simd_find_whitespace(const char* ptr, const char* end) {
+    return scan()->find_whitespace(ptr, end);
+}
+
+/* Number of whitespace separated tokens */
+static inline size_t simd_count_tokens(const char* ptr, const char* end) {
+    return scan()->count_tokens(ptr, end);
+}
+
+/* ============================================================================
+ * OPTIMIZATION 2: SIMD Whitespace Trimming
+ * Leading whitespace is skipped with the dispatched scan kernel
+ * ============================================================================ */
+
+static inline const char* simd_skip_leading_whitespace(const char* str, const char* end) {
+    return scan()->skip_whitespace(str, end);
+}
+
 static inline const char* simd_skip_trailing_whitespace(const char* str, const char* end) {
     // Work backwards from end
     const char* ptr = end - 1;
@@ -174,101 +644,29 @@ typedef struct
     bool        has_leading_ws; // True if line starts with whitespace
 } SeparatorInfo;
 
+/* First separator or comment character of the line: whichever of '=', ':'
+ * and '#' comes first */
 static inline void simd_find_special_chars(const char* str, const char* str_end,
                                            SeparatorInfo* info) {
-    const char* ptr = str;
-    size_t      len = str_end - str;
-
-    info->sep_char       = '\0';
-    info->sep_pos        = NULL;
-    info->has_leading_ws = false;
-
-    // Check first character for whitespace (continuation line check)
-    if (len > 0 && (*ptr == ' ' || *ptr == '\t')) {
-        info->has_leading_ws = true;
-    }
-
-    if (len >= 32) {
-        __m256i equals_vec = _mm256_set1_epi8('=');
-        __m256i colon_vec  = _mm256_set1_epi8(':');
-        __m256i hash_vec   = _mm256_set1_epi8('#');
-
-        while (ptr + 32 <= str_end) {
-            __m256i data      = _mm256_loadu_si256((const __m256i*)ptr);
-            __m256i cmp_eq    = _mm256_cmpeq_epi8(data, equals_vec);
-            __m256i cmp_colon = _mm256_cmpeq_epi8(data, colon_vec);
-            __m256i cmp_hash  = _mm256_cmpeq_epi8(data, hash_vec);
-
-            int mask_eq    = _mm256_movemask_epi8(cmp_eq);
-            int mask_colon = _mm256_movemask_epi8(cmp_colon);
-            int mask_hash  = _mm256_movemask_epi8(cmp_hash);
-
-            // Check for comment first (highest priority)
-            if (mask_hash != 0) {
-                int offset     = __builtin_ctz(mask_hash);
-                info->sep_char = '#';
-                info->sep_pos  = ptr + offset;
-                return;
-            }
-
-            // Find which separator comes first
-            if (mask_eq != 0 && mask_colon != 0) {
-                int offset_eq    = __builtin_ctz(mask_eq);
-                int offset_colon = __builtin_ctz(mask_colon);
-                if (offset_eq < offset_colon) {
-                    info->sep_char = '=';
-                    info->sep_pos  = ptr + offset_eq;
-                } else {
-                    info->sep_char = ':';
-                    info->sep_pos  = ptr + offset_colon;
-                }
-                return;
-            } else if (mask_eq != 0) {
-                int offset     = __builtin_ctz(mask_eq);
-                info->sep_char = '=';
-                info->sep_pos  = ptr + offset;
-                return;
-            } else if (mask_colon != 0) {
-                int offset     = __builtin_ctz(mask_colon);
-                info->sep_char = ':';
-                info->sep_pos  = ptr + offset;
-                return;
-            }
-
-            ptr += 32;
-        }
-    }
-
-    // Scalar fallback for remaining bytes
-    while (ptr < str_end) {
-        if (*ptr == '#') {
-            info->sep_char = '#';
-            info->sep_pos  = ptr;
-            return;
-        }
-        if (*ptr == '=') {
-            info->sep_char = '=';
-            info->sep_pos  = ptr;
-            return;
-        }
-        if (*ptr == ':') {
-            info->sep_char = ':';
-            info->sep_pos  = ptr;
-            return;
-        }
-        ptr++;
-    }
+    const char* pos      = scan()->find_separator(str, str_end);
+    info->has_leading_ws = (str < str_end && (*str == ' ' || *str == '\t'));
+    info->sep_char       = (pos < str_end) ? *pos : '\0';
+    info->sep_pos        = (pos < str_end) ? pos : NULL;
 }
 
 /* ============================================================================
  * Main parsing function with all 4 optimizations
  * ============================================================================ */
 
-void infofile_parse_string(const char* data, size_t len, InfoFile* info) {
+/* Parse a buffer; with zero_copy keys and single-line values are views into
+ * data, which must outlive the entries. Multi-line values are always joined
+ * into value_arena. */
+static void parse_buffer(const char* data, size_t len, InfoFile* info, bool zero_copy) {
     const char* ptr = data;
     const char* end = data + len;
 
     const char* current_key       = NULL;
+    size_t      current_key_len   = 0;
     char*       value_buffer      = NULL;
     size_t      value_buffer_size = 0;
     size_t      value_buffer_used = 0;
@@ -345,16 +743,10 @@ void infofile_parse_string(const char* data, size_t len, InfoFile* info) {
 
         // If we have a pending multiline value, save it
         if (current_key != NULL) {
-            ensure_capacity(info);
-            info->entries[info->count].key = current_key;
-            if (value_buffer && value_buffer_used > 0) {
-                info->entries[info->count].value =
-                    arena_strndup(&info->arena.value_arena, value_buffer, value_buffer_used);
-            } else {
-                info->entries[info->count].value =
-                    arena_strndup(&info->arena.value_arena, "", 0);
-            }
-            info->count++;
+            size_t      value_len = value_buffer ? value_buffer_used : 0;
+            const char* value = arena_strndup(&info->arena.value_arena,
+                                              value_len ? value_buffer : "", value_len);
+            add_entry(info, current_key, current_key_len, value, value_len);
             current_key = NULL;
             if (value_buffer) {
                 value_buffer_used = 0;
@@ -384,21 +776,25 @@ void infofile_parse_string(const char* data, size_t len, InfoFile* info) {
             size_t key_len = key_end - key_start;
             size_t val_len = val_end - val_start;
 
-            current_key       = arena_strndup(&info->arena.key_arena, key_start, key_len);
-            const char* value = arena_strndup(&info->arena.value_arena, val_start, val_len);
+            const char* value;
+            if (zero_copy) {
+                current_key = key_start;
+                value       = val_start;
+            } else {
+                current_key = arena_strndup(&info->arena.key_arena, key_start, key_len);
+                value       = arena_strndup(&info->arena.value_arena, val_start, val_len);
+            }
 
-            ensure_capacity(info);
-            info->entries[info->count].key   = current_key;
-            info->entries[info->count].value = value;
-            info->count++;
+            add_entry(info, current_key, key_len, value, val_len);
             current_key = NULL;
         } else if (sep_info.sep_char == ':') {
             // Multi-line format: key:
             const char *key_start, *key_end;
             simd_trim_zero_copy(trim_start, sep_info.sep_pos, &key_start, &key_end);
 
-            size_t key_len = key_end - key_start;
-            current_key    = arena_strndup(&info->arena.key_arena, key_start, key_len);
+            current_key_len = key_end - key_start;
+            current_key     = zero_copy ? key_start
+                                        : arena_strndup(&info->arena.key_arena, key_start, current_key_len);
 
             // Check if there's content after the colon
             if (sep_info.sep_pos + 1 < trim_end) {
@@ -444,16 +840,10 @@ void infofile_parse_string(const char* data, size_t len, InfoFile* info) {
 
     // Save any pending value
     if (current_key != NULL) {
-        ensure_capacity(info);
-        info->entries[info->count].key = current_key;
-        if (value_buffer && value_buffer_used > 0) {
-            info->entries[info->count].value =
-                arena_strndup(&info->arena.value_arena, value_buffer, value_buffer_used);
-        } else {
-            info->entries[info->count].value =
-                arena_strndup(&info->arena.value_arena, "", 0);
-        }
-        info->count++;
+        size_t      value_len = value_buffer ? value_buffer_used : 0;
+        const char* value = arena_strndup(&info->arena.value_arena,
+                                          value_len ? value_buffer : "", value_len);
+        add_entry(info, current_key, current_key_len, value, value_len);
     }
 
     if (value_buffer) {
@@ -461,18 +851,13 @@ void infofile_parse_string(const char* data, size_t len, InfoFile* info) {
     }
 }
 
-void infofile_parse_file(const char* filename, InfoFile* info) {
-    FILE* fp = fopen(filename, "rb");
-    if (!fp) {
-        fprintf(stderr, "FATAL: Failed to open file '%s'\n", filename);
-        exit(1);
-    }
-
-    fseek(fp, 0, SEEK_END);
-    long file_size = ftell(fp);
-    fseek(fp, 0, SEEK_SET);
+void infofile_parse_string(const char* data, size_t len, InfoFile* info) {
+    parse_buffer(data, len, info, false);
+    update_sorted_index(info);
+}
 
-    // Pre-allocate entries array based on file size
+/* Pre-allocate entries array and key index based on file size */
+static void reserve_entries(InfoFile* info, size_t file_size) {
     size_t estimated_entries = file_size / 150;
     if (estimated_entries > info->capacity) {
         size_t new_capacity = estimated_entries;
@@ -480,12 +865,26 @@ void infofile_parse_file(const char* filename, InfoFile* info) {
         if (!new_entries) {
             fprintf(stderr, "FATAL: Failed to reallocate entries array (%zu bytes)\n",
                     new_capacity * sizeof(InfoFileEntry));
-            fclose(fp);
             exit(1);
         }
         info->entries = new_entries;
         info->capacity = new_capacity;
     }
+    reserve_slots(info, estimated_entries);
+}
+
+void infofile_parse_file(const char* filename, InfoFile* info) {
+    FILE* fp = fopen(filename, "rb");
+    if (!fp) {
+        fprintf(stderr, "FATAL: Failed to open file '%s'\n", filename);
+        exit(1);
+    }
+
+    fseek(fp, 0, SEEK_END);
+    long file_size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    reserve_entries(info, (size_t)file_size);
 
     // Pre-allocate both arenas to avoid reallocation during parsing
     // Keys typically use less space than values
@@ -510,21 +909,577 @@ void infofile_parse_file(const char* filename, InfoFile* info) {
     free(buffer);
 }
 
+/* ============================================================================
+ * OPTIMIZATION 8: Parallel Parsing
+ * The buffer is cut at lines that start a new entry, so no chunk begins
+ * inside a multi-line value. Each chunk is parsed into its own entries and
+ * arenas, hashed and sorted by a worker; the main thread appends the chunks
+ * in file order, splices their arenas and merges the sorted runs.
+ * ============================================================================ */
+
+#define PARALLEL_MIN_CHUNK (1024 * 1024) // Smaller chunks are not worth a thread
+
+typedef struct {
+    const char* start;   /* First byte of the chunk (start of an entry line) */
+    const char* end;     /* One past the last byte */
+    InfoFile    part;    /* Entries and arenas of this chunk, no key index */
+    uint32_t*   hashes;  /* Key hash per entry */
+    uint32_t*   sorted;  /* Entry positions in key order */
+} ParseChunk;
+
+/* True when a line starts an entry: not blank, not a comment, not a continuation */
+static bool is_entry_line(const char* line_start, const char* line_end) {
+    if (line_end > line_start && *(line_end - 1) == '\r')
+        line_end--;
+    size_t line_len = line_end - line_start;
+    if (line_len == 0)
+        return false;
+
+    const char *trim_start, *trim_end;
+    simd_trim_zero_copy(line_start, line_end, &trim_start, &trim_end);
+    if (trim_start >= trim_end || *trim_start == '#')
+        return false;
+    return !(*line_start == '\t' || (*line_start == ' ' && line_len > 1));
+}
+
+/* First entry line starting at or after pos (pos must be a line start) */
+static const char* next_entry_line(const char* pos, const char* end) {
+    while (pos < end) {
+        const char* newline  = simd_find_newline_opt(pos, end);
+        const char* line_end = newline ? newline : end;
+        if (is_entry_line(pos, line_end))
+            return pos;
+        pos = newline ? newline + 1 : end;
+    }
+    return end;
+}
+
+static void parse_chunk_task(void* context, size_t task) {
+    ParseChunk* chunk = &((ParseChunk*)context)[task];
+    InfoFile*   part  = &chunk->part;
+    size_t      bytes = (size_t)(chunk->end - chunk->start);
+
+    part->capacity = bytes / 150 + INITIAL_CAPACITY;
+    part->entries  = malloc(part->capacity * sizeof(InfoFileEntry));
+    if (!part->entries) {
+        fprintf(stderr, "FATAL: Failed to allocate chunk entries (%zu bytes)\n",
+                part->capacity * sizeof(InfoFileEntry));
+        exit(1);
+    }
+    arena_init(&part->arena.key_arena, bytes / 3 + INITIAL_ARENA_SIZE);
+    arena_init(&part->arena.value_arena, bytes * 5 / 3 + INITIAL_ARENA_SIZE);
+
+    parse_buffer(chunk->start, bytes, part, false);
+
+    size_t    count = part->count;
+    uint32_t* tmp   = malloc((count + 1) * sizeof(uint32_t));
+    chunk->hashes   = malloc((count + 1) * sizeof(uint32_t));
+    chunk->sorted   = malloc((count + 1) * sizeof(uint32_t));
+    if (!tmp || !chunk->hashes || !chunk->sorted) {
+        fprintf(stderr, "FATAL: Failed to allocate chunk index (%zu entries)\n", count);
+        exit(1);
+    }
+    for (size_t i = 0; i < count; i++) {
+        chunk->hashes[i] = hash_key(part->entries[i].key, part->entries[i].key_len);
+        chunk->sorted[i] = (uint32_t)i;
+    }
+    sort_keys(part, chunk->sorted, tmp, count);
+    free(tmp);
+}
+
+void infofile_parse_string_parallel(const char* data, size_t len, InfoFile* info,
+                                    size_t thread_count) {
+    if (thread_count == 0)
+        thread_count = parallel_default_threads();
+    size_t chunk_count = len / PARALLEL_MIN_CHUNK;
+    if (chunk_count > thread_count)
+        chunk_count = thread_count;
+    if (chunk_count < 2) {
+        infofile_parse_string(data, len, info);
+        return;
+    }
+
+    ParseChunk* chunks = calloc(chunk_count, sizeof(ParseChunk));
+    if (!chunks) {
+        fprintf(stderr, "FATAL: Failed to allocate parse chunks (%zu bytes)\n",
+                chunk_count * sizeof(ParseChunk));
+        exit(1);
+    }
+
+    /* Cut at the first entry line after each even split point */
+    const char* end = data + len;
+    chunks[0].start = data;
+    for (size_t i = 1; i < chunk_count; i++) {
+        const char* cut     = data + len / chunk_count * i;
+        const char* newline = simd_find_newline_opt(cut - 1, end);
+        cut                 = newline ? next_entry_line(newline + 1, end) : end;
+        if (cut < chunks[i - 1].start)
+            cut = chunks[i - 1].start;
+        chunks[i].start   = cut;
+        chunks[i - 1].end = cut;
+    }
+    chunks[chunk_count - 1].end = end;
+
+    parallel_for(chunk_count, thread_count, parse_chunk_task, chunks);
+
+    /* Append in file order */
+    size_t old_count = info->count;
+    size_t total     = old_count;
+    for (size_t i = 0; i < chunk_count; i++)
+        total += chunks[i].part.count;
+    if (total > info->capacity) {
+        InfoFileEntry* entries = realloc(info->entries, total * sizeof(InfoFileEntry));
+        if (!entries) {
+            fprintf(stderr, "FATAL: Failed to reallocate entries array (%zu bytes)\n",
+                    total * sizeof(InfoFileEntry));
+            exit(1);
+        }
+        info->entries  = entries;
+        info->capacity = total;
+    }
+    reserve_slots(info, info->slot_used + (total - old_count));
+
+    update_sorted_index(info); /* Entries from earlier parses, normally none */
+    uint32_t* sorted = realloc(info->sorted, (total + 1) * sizeof(uint32_t));
+    uint32_t* tmp    = malloc((total + 1) * sizeof(uint32_t));
+    if (!sorted || !tmp) {
+        fprintf(stderr, "FATAL: Failed to allocate sorted key index (%zu bytes)\n",
+                total * sizeof(uint32_t));
+        exit(1);
+    }
+    info->sorted = sorted;
+
+    for (size_t i = 0; i < chunk_count; i++) {
+        ParseChunk* chunk = &chunks[i];
+        size_t      base  = info->count;
+        size_t      count = chunk->part.count;
+        memcpy(info->entries + base, chunk->part.entries, count * sizeof(InfoFileEntry));
+        info->count += count;
+        for (size_t j = 0; j < count; j++) {
+            index_entry(info, base + j, chunk->hashes[j]);
+            chunk->sorted[j] += (uint32_t)base;
+        }
+        arena_merge(&info->arena.key_arena, &chunk->part.arena.key_arena);
+        arena_merge(&info->arena.value_arena, &chunk->part.arena.value_arena);
+
+        /* Merge this chunk's run into the sorted index */
+        memcpy(tmp, info->sorted, info->sorted_count * sizeof(uint32_t));
+        merge_runs(info, tmp, info->sorted_count, chunk->sorted, count, info->sorted);
+        info->sorted_count += count;
+
+        free(chunk->part.entries);
+        free(chunk->hashes);
+        free(chunk->sorted);
+    }
+
+    free(tmp);
+    free(chunks);
+}
+
+void infofile_parse_file_parallel(const char* filename, InfoFile* info, size_t thread_count) {
+    FILE* fp = fopen(filename, "rb");
+    if (!fp) {
+        fprintf(stderr, "FATAL: Failed to open file '%s'\n", filename);
+        exit(1);
+    }
+
+    fseek(fp, 0, SEEK_END);
+    long file_size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    char* buffer = malloc(file_size + 1);
+    if (!buffer) {
+        fprintf(stderr, "FATAL: Failed to allocate file buffer (%ld bytes)\n", file_size + 1);
+        fclose(fp);
+        exit(1);
+    }
+
+    size_t bytes_read  = fread(buffer, 1, file_size, fp);
+    buffer[bytes_read] = '\0';
+    fclose(fp);
+
+    infofile_parse_string_parallel(buffer, bytes_read, info, thread_count);
+    free(buffer);
+}
+
+/* ============================================================================
+ * OPTIMIZATION 7: Memory-Mapped Zero-Copy Mode
+ * Keys and single-line values stay in the page cache as (pointer, length)
+ * views; only joined multi-line values are copied into value_arena
+ * ============================================================================ */
+
+void infofile_map_file(const char* filename, InfoFile* info) {
+    if (info->mapped_data) {
+        fprintf(stderr, "FATAL: InfoFile already holds a mapped file\n");
+        exit(1);
+    }
+
+    size_t size = 0;
+    void*  data = NULL;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    LARGE_INTEGER file_size;
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &file_size)) {
+        fprintf(stderr, "FATAL: Failed to open file '%s'\n", filename);
+        exit(1);
+    }
+    size = (size_t)file_size.QuadPart;
+    if (size > 0) {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        data           = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+        if (mapping)
+            CloseHandle(mapping);
+    }
+    CloseHandle(file);
+#else
+    int         fd = open(filename, O_RDONLY);
+    struct stat st;
+    if (fd == -1 || fstat(fd, &st) != 0) {
+        fprintf(stderr, "FATAL: Failed to open file '%s'\n", filename);
+        exit(1);
+    }
+    size = (size_t)st.st_size;
+    if (size > 0) {
+        data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+            data = NULL;
+        else
+            madvise(data, size, MADV_SEQUENTIAL);
+    }
+    close(fd);
+#endif
+    if (size == 0)
+        return;
+    if (!data) {
+        fprintf(stderr, "FATAL: Failed to map file '%s' (%zu bytes)\n", filename, size);
+        exit(1);
+    }
+
+    info->mapped_data = data;
+    info->mapped_size = size;
+    reserve_entries(info, size);
+    parse_buffer(data, size, info, true);
+    update_sorted_index(info);
+}
+
+const InfoFileEntry* infofile_get_entry(const InfoFile* info, const char* key) {
+    // Hash probe - slots carry hash and length, key bytes only on a likely hit
+    if (!info->slots)
+        return NULL;
+    size_t        len  = strlen(key);
+    InfoFileSlot* slot = find_slot(info, key, len, hash_key(key, len));
+    return slot->index ? &info->entries[slot->index - 1] : NULL;
+}
+
 const char* infofile_get(const InfoFile* info, const char* key) {
-    // Linear search - keys are in key_arena for better cache locality
-    for (size_t i = 0; i < info->count; i++) {
-        if (strcmp(info->entries[i].key, key) == 0) {
-            return info->entries[i].value;
+    const InfoFileEntry* entry = infofile_get_entry(info, key);
+    return entry ? entry->value : NULL;
+}
+
+size_t infofile_get_prefix(const InfoFile* info, const char* prefix, InfoFileCursor* cursor) {
+    size_t len    = strlen(prefix);
+    cursor->info  = info;
+    cursor->next  = prefix_bound(info, prefix, len, 0, info->sorted_count, 0);
+    cursor->end   = prefix_bound(info, prefix, len, cursor->next, info->sorted_count, 1);
+    return cursor->end - cursor->next;
+}
+
+const InfoFileEntry* infofile_cursor_next(InfoFileCursor* cursor) {
+    if (cursor->next >= cursor->end)
+        return NULL;
+    return &cursor->info->entries[cursor->info->sorted[cursor->next++]];
+}
+
+size_t infofile_get_children(const InfoFile* info, const char* parent,
+                             InfoFileChild* children, size_t max) {
+    /* Children live below "parent." */
+    size_t parent_len = parent ? strlen(parent) : 0;
+    size_t base       = parent_len ? parent_len + 1 : 0;
+    char*  prefix     = malloc(base + 1);
+    if (!prefix) {
+        fprintf(stderr, "FATAL: Failed to allocate prefix buffer (%zu bytes)\n", base + 1);
+        exit(1);
+    }
+    if (parent_len) {
+        memcpy(prefix, parent, parent_len);
+        prefix[parent_len] = '.';
+    }
+    prefix[base] = '\0';
+
+    InfoFileCursor range;
+    infofile_get_prefix(info, prefix, &range);
+    free(prefix);
+
+    /* Each child's key and subtree form one run that a bound search skips */
+    size_t found = 0;
+    size_t pos   = range.next;
+    while (pos < range.end) {
+        const InfoFileEntry* entry = &info->entries[info->sorted[pos]];
+        const char*          name  = entry->key + base;
+        const char*          dot   = memchr(name, '.', entry->key_len - base);
+        size_t               len   = dot ? (size_t)(dot - name) : entry->key_len - base;
+        size_t               end   = subtree_end(info, entry->key, base + len, pos, range.end);
+        if (found < max) {
+            children[found].name         = name;
+            children[found].name_len     = len;
+            children[found].entries.info = info;
+            children[found].entries.next = pos;
+            children[found].entries.end  = end;
         }
+        found++;
+        pos = end;
     }
-    return NULL;
+    return found;
+}
+
+/* ============================================================================
+ * OPTIMIZATION 9: Typed Numeric Accessors
+ * Decimal numbers whose significand fits in 53 bits and whose exponent is
+ * small are converted exactly with one IEEE multiply or divide (Clinger's
+ * fast path), eight digits at a time with SWAR. Everything else goes to
+ * strtod with the decimal point adapted to the current locale. Whitespace
+ * between array tokens is found with AVX2.
+ * ============================================================================ */
+
+static const double exact_powers_of_ten[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+#define FAST_PATH_MAX_MANTISSA (1ull << 53)
+
+/* True when all 8 bytes of v are ASCII digits */
+static inline bool is_eight_digits(uint64_t v) {
+    return ((v & 0xF0F0F0F0F0F0F0F0ull) |
+            (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+}
+
+/* Value of 8 ASCII digits loaded little-endian */
+static inline uint32_t parse_eight_digits(uint64_t v) {
+    const uint64_t mask = 0x000000FF000000FFull;
+    const uint64_t mul1 = 0x000F424000000064ull; /* 100 + (1000000 << 32) */
+    const uint64_t mul2 = 0x0000271000000001ull; /* 1 + (10000 << 32) */
+    v -= 0x3030303030303030ull;
+    v = (v * 10) + (v >> 8);
+    v = (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    return (uint32_t)v;
+}
+
+/* Accumulate a run of digits into *mantissa; returns the end of the run */
+static inline const char* parse_digits(const char* p, const char* end, uint64_t* mantissa) {
+    uint64_t m = *mantissa;
+    while (end - p >= 8) {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        if (!is_eight_digits(v))
+            break;
+        m = m * 100000000u + parse_eight_digits(v);
+        p += 8;
+    }
+    while (p < end && (unsigned)(*p - '0') <= 9) {
+        m = m * 10 + (uint64_t)(*p - '0');
+        p++;
+    }
+    *mantissa = m;
+    return p;
+}
+
+/* Exact conversion when [p, end) is a plain decimal within the fast path */
+static bool parse_double_fast(const char* p, const char* end, double* out) {
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+
+    uint64_t    mantissa  = 0;
+    const char* int_start = p;
+    p                     = parse_digits(p, end, &mantissa);
+    size_t digits         = (size_t)(p - int_start);
+    long   exponent       = 0;
+    if (p < end && *p == '.') {
+        const char* frac_start = ++p;
+        /* Stop short of overflowing the 64-bit significand */
+        if (digits < 20)
+            p = parse_digits(p, end, &mantissa);
+        size_t frac_digits = (size_t)(p - frac_start);
+        digits += frac_digits;
+        exponent = -(long)frac_digits;
+    }
+    if (digits == 0 || digits > 19)
+        return false;
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool exp_negative = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            exp_negative = (*p == '-');
+            p++;
+        }
+        if (p >= end || (unsigned)(*p - '0') > 9)
+            return false;
+        long exp_value = 0;
+        while (p < end && (unsigned)(*p - '0') <= 9) {
+            if (exp_value < 100000)
+                exp_value = exp_value * 10 + (*p - '0');
+            p++;
+        }
+        exponent += exp_negative ? -exp_value : exp_value;
+    }
+    if (p != end || mantissa > FAST_PATH_MAX_MANTISSA)
+        return false;
+
+    double value;
+    if (exponent >= -22 && exponent < 0) {
+        value = (double)mantissa / exact_powers_of_ten[-exponent];
+    } else if (exponent >= 0 && exponent <= 22) {
+        value = (double)mantissa * exact_powers_of_ten[exponent];
+    } else if (exponent > 22 && exponent <= 22 + 15) {
+        /* Move the excess into the significand while it stays exact */
+        for (long e = exponent - 22; e > 0; e--) {
+            mantissa *= 10;
+            if (mantissa > FAST_PATH_MAX_MANTISSA)
+                return false;
+        }
+        value = (double)mantissa * 1e22;
+    } else {
+        return false;
+    }
+    *out = negative ? -value : value;
+    return true;
+}
+
+/* strtod on a copy of the token, with '.' swapped for the locale's point */
+static bool parse_double_slow(const char* p, size_t len, double* out) {
+    char  local[64];
+    char* buffer = len < sizeof(local) ? local : malloc(len + 1);
+    if (!buffer) {
+        fprintf(stderr, "FATAL: Failed to allocate number buffer (%zu bytes)\n", len + 1);
+        exit(1);
+    }
+    memcpy(buffer, p, len);
+    buffer[len] = '\0';
+
+    char point = localeconv()->decimal_point[0];
+    if (point != '.') {
+        for (size_t i = 0; i < len; i++) {
+            if (buffer[i] == '.')
+                buffer[i] = point;
+        }
+    }
+
+    char*  parse_end;
+    double value = strtod(buffer, &parse_end);
+    bool   ok    = len > 0 && !isspace((unsigned char)buffer[0]) && parse_end == buffer + len;
+    if (buffer != local)
+        free(buffer);
+    if (ok)
+        *out = value;
+    return ok;
+}
+
+int infofile_parse_double(const char* str, size_t len, double* out) {
+    if (parse_double_fast(str, str + len, out) || parse_double_slow(str, len, out))
+        return 0;
+    return -1;
+}
+
+int infofile_get_double(const InfoFile* info, const char* key, double* out) {
+    const InfoFileEntry* entry = infofile_get_entry(info, key);
+    if (!entry)
+        return -1;
+    return infofile_parse_double(entry->value, entry->value_len, out);
+}
+
+int infofile_get_int(const InfoFile* info, const char* key, int64_t* out) {
+    const InfoFileEntry* entry = infofile_get_entry(info, key);
+    if (!entry)
+        return -1;
+
+    const char* p        = entry->value;
+    const char* end      = p + entry->value_len;
+    bool        negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+    if (p >= end)
+        return -1;
+
+    /* Accumulate as a negative number so INT64_MIN fits */
+    int64_t value = 0;
+    for (; p < end; p++) {
+        unsigned digit = (unsigned)(*p - '0');
+        if (digit > 9 || value < (INT64_MIN + (int64_t)digit) / 10)
+            return -1;
+        value = value * 10 - (int64_t)digit;
+    }
+    if (!negative) {
+        if (value == INT64_MIN)
+            return -1;
+        value = -value;
+    }
+    *out = value;
+    return 0;
+}
+
+double* infofile_get_double_array(InfoFile* info, const char* key, double* out, size_t* count) {
+    const InfoFileEntry* entry = infofile_get_entry(info, key);
+    if (!entry) {
+        *count = 0;
+        return NULL;
+    }
+
+    const char* p        = entry->value;
+    const char* end      = p + entry->value_len;
+    size_t      capacity = *count;
+    if (!out) {
+        /* Exact size from a token count, aligned for vector loads */
+        capacity = simd_count_tokens(p, end);
+        out      = (double*)arena_alloc_aligned(&info->arena.value_arena, capacity * sizeof(double), 32);
+    }
+
+    size_t n = 0;
+    for (;;) {
+        p = simd_skip_leading_whitespace(p, end);
+        if (p >= end)
+            break;
+        const char* token_end = simd_find_whitespace(p, end);
+        double      value;
+        if (infofile_parse_double(p, (size_t)(token_end - p), &value) != 0) {
+            *count = n;
+            return NULL;
+        }
+        if (n < capacity)
+            out[n] = value;
+        n++;
+        p = token_end;
+    }
+    *count = n;
+    return out;
 }
 
 void infofile_free(InfoFile* info) {
     free(info->entries);
+    free(info->slots);
+    free(info->sorted);
+    if (info->mapped_data) {
+#ifdef _WIN32
+        UnmapViewOfFile((void*)info->mapped_data);
+#else
+        munmap((void*)info->mapped_data, info->mapped_size);
+#endif
+    }
     arena_free(&info->arena.key_arena);
     arena_free(&info->arena.value_arena);
-    info->entries  = NULL;
-    info->count    = 0;
-    info->capacity = 0;
+    info->entries   = NULL;
+    info->count     = 0;
+    info->capacity  = 0;
+    info->slots     = NULL;
+    info->slot_mask = 0;
+    info->slot_used = 0;
+    info->sorted       = NULL;
+    info->sorted_count = 0;
+    info->mapped_data  = NULL;
+    info->mapped_size  = 0;
 }
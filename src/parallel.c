@@ -0,0 +1,193 @@
+#include <parallel.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#endif
+
+/* Upper bound on threads created by one parallel_for() call */
+#define PARALLEL_MAX_THREADS 256
+
+typedef struct {
+    ParallelTask fn;
+    void*        context;
+    size_t       task_count;
+#ifdef _WIN32
+    volatile LONG64 next_task;      /* Next task to hand out */
+    volatile LONG64 finished;       /* Tasks completed */
+#else
+    atomic_size_t   next_task;      /* Next task to hand out */
+    atomic_size_t   finished;       /* Tasks completed */
+#endif
+} ParallelJob;
+
+struct ParallelGroup {
+    ParallelJob  job;
+    size_t       thread_count;      /* Threads started */
+#ifdef _WIN32
+    HANDLE       threads[PARALLEL_MAX_THREADS];
+#else
+    pthread_t    threads[PARALLEL_MAX_THREADS];
+#endif
+};
+
+static void init_job(ParallelJob* job, size_t task_count, ParallelTask fn, void* context) {
+    job->fn         = fn;
+    job->context    = context;
+    job->task_count = task_count;
+#ifdef _WIN32
+    job->next_task = 0;
+    job->finished  = 0;
+#else
+    atomic_init(&job->next_task, 0);
+    atomic_init(&job->finished, 0);
+#endif
+}
+
+static size_t claim_task(ParallelJob* job) {
+#ifdef _WIN32
+    return (size_t)(InterlockedIncrement64(&job->next_task) - 1);
+#else
+    return atomic_fetch_add_explicit(&job->next_task, 1, memory_order_relaxed);
+#endif
+}
+
+static void run_tasks(ParallelJob* job) {
+    for (size_t task = claim_task(job); task < job->task_count; task = claim_task(job)) {
+        job->fn(job->context, task);
+        /* Release: results of the task are visible to whoever sees the count */
+#ifdef _WIN32
+        InterlockedIncrement64(&job->finished);
+#else
+        atomic_fetch_add_explicit(&job->finished, 1, memory_order_release);
+#endif
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI worker_main(LPVOID arg) {
+    run_tasks((ParallelJob*)arg);
+    return 0;
+}
+#else
+static void* worker_main(void* arg) {
+    run_tasks((ParallelJob*)arg);
+    return NULL;
+}
+#endif
+
+size_t parallel_default_threads(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (size_t)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (size_t)count : 1;
+#endif
+}
+
+/* Clamp a requested thread count to [1, min(task_count, PARALLEL_MAX_THREADS)] */
+static size_t clamp_threads(size_t thread_count, size_t task_count) {
+    if (thread_count == 0) {
+        thread_count = parallel_default_threads();
+    }
+    if (thread_count > task_count) {
+        thread_count = task_count;
+    }
+    if (thread_count > PARALLEL_MAX_THREADS) {
+        thread_count = PARALLEL_MAX_THREADS;
+    }
+    return thread_count > 0 ? thread_count : 1;
+}
+
+/* Start up to count workers on the group's job; returns how many started.
+ * Workers that fail to start are simply not waited for. */
+static size_t start_workers(ParallelGroup* group, size_t count) {
+    size_t started = 0;
+    for (size_t t = 0; t < count; t++) {
+#ifdef _WIN32
+        group->threads[started] = CreateThread(NULL, 0, worker_main, &group->job, 0, NULL);
+        if (!group->threads[started]) {
+            break;
+        }
+#else
+        if (pthread_create(&group->threads[started], NULL, worker_main, &group->job) != 0) {
+            break;
+        }
+#endif
+        started++;
+    }
+    group->thread_count = started;
+    return started;
+}
+
+static void join_workers(ParallelGroup* group) {
+    for (size_t t = 0; t < group->thread_count; t++) {
+#ifdef _WIN32
+        WaitForSingleObject(group->threads[t], INFINITE);
+        CloseHandle(group->threads[t]);
+#else
+        pthread_join(group->threads[t], NULL);
+#endif
+    }
+    group->thread_count = 0;
+}
+
+void parallel_for(size_t task_count, size_t thread_count, ParallelTask fn, void* context) {
+    thread_count = clamp_threads(thread_count, task_count);
+
+    /* Nothing to share: run inline */
+    if (thread_count <= 1) {
+        for (size_t task = 0; task < task_count; task++) {
+            fn(context, task);
+        }
+        return;
+    }
+
+    ParallelGroup group;
+    init_job(&group.job, task_count, fn, context);
+
+    /* The caller is one of the threads and picks up whatever
+     * workers that failed to start would have done */
+    start_workers(&group, thread_count - 1);
+    run_tasks(&group.job);
+    join_workers(&group);
+}
+
+ParallelGroup* parallel_start(size_t task_count, size_t thread_count, ParallelTask fn, void* context) {
+    ParallelGroup* group = (ParallelGroup*)malloc(sizeof(ParallelGroup));
+    if (!group) {
+        fprintf(stderr, "FATAL: Failed to allocate parallel task group\n");
+        exit(1);
+    }
+    init_job(&group->job, task_count, fn, context);
+    group->thread_count = 0;
+
+    if (task_count > 0 && start_workers(group, clamp_threads(thread_count, task_count)) == 0) {
+        run_tasks(&group->job);
+    }
+    return group;
+}
+
+int parallel_poll(ParallelGroup* group) {
+#ifdef _WIN32
+    size_t finished = (size_t)InterlockedCompareExchange64(&group->job.finished, 0, 0);
+#else
+    size_t finished = atomic_load_explicit(&group->job.finished, memory_order_acquire);
+#endif
+    return finished >= group->job.task_count;
+}
+
+void parallel_wait(ParallelGroup* group) {
+    if (!group) {
+        return;
+    }
+    join_workers(group);
+    free(group);
+}
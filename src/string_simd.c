@@ -1,156 +1,237 @@
-#include <immintrin.h> // AVX2 intrinsics
+#include <cpu_dispatch.h>
+#include <immintrin.h> // SSE4.2 / AVX2 / AVX-512 intrinsics (per-function targets)
 #include <stddef.h>
 #include <stdint.h>
-
-/**
- * SIMD-optimized strlen using AVX2
- * Processes 32 bytes at a time to find null terminator
+#include <string.h>
+#include <string_simd.h>
+
+/* The strlen kernels read whole aligned blocks, which may run past the
+ * terminator into bytes the allocator has not handed out (never across a
+ * page). That is safe on hardware but looks like an overflow to ASan. */
+#if defined(__GNUC__) || defined(__clang__)
+#define NO_ASAN __attribute__((no_sanitize_address))
+#else
+#define NO_ASAN
+#endif
+
+/* ============================================================================
+ * strlen variants
  *
- * Uses three-phase approach:
+ * Two-phase approach shared by the vector kernels:
  * 1. Alignment loop: Process bytes until aligned OR null found (scalar)
- * 2. Main loop: Process aligned 32-byte chunks (fast aligned loads)
- * 3. Safe throughout: Uses unaligned loads to avoid page boundary issues
- */
-size_t strlen_simd(const char* str) {
-    const char* s = str;
-    __m256i zero = _mm256_setzero_si256();
+ * 2. Main loop: Process aligned blocks; an aligned block never crosses a
+ *    page boundary, so reading past the terminator cannot fault
+ * ============================================================================ */
+
+static size_t strlen_scalar(const char* str) {
+    return strlen(str);
+}
 
-    /* Phase 1: Handle unaligned start - process bytes until 32-byte aligned
-     * IMPORTANT: Check for null terminator to avoid reading past string end */
-    uintptr_t addr         = (uintptr_t)s;
-    size_t    misalignment = addr & 31;
-
-    if (misalignment != 0) {
-        /* Process bytes one at a time until aligned OR null found */
-        while (((uintptr_t)s & 31) != 0) {
-            if (*s == '\0') {
-                return s - str;
-            }
-            s++;
+CPU_TARGET_SSE42 NO_ASAN static size_t strlen_sse42(const char* str) {
+    const char* s = str;
+    while (((uintptr_t)s & 15) != 0) {
+        if (*s == '\0') {
+            return s - str;
         }
+        s++;
     }
 
-    /* Phase 2: Main loop - s is now 32-byte aligned
-     * Use aligned loads for better performance, but we still use unaligned
-     * loads to be safe near page boundaries */
+    __m128i zero = _mm_setzero_si128();
     while (1) {
-        /* Use unaligned load to be safe - compiler/CPU will optimize if aligned
-         * This prevents segfaults when crossing page boundaries */
-        __m256i chunk = _mm256_loadu_si256((const __m256i*)s);
-
-        /* Compare with zero */
-        __m256i cmp = _mm256_cmpeq_epi8(chunk, zero);
+        __m128i  chunk = _mm_load_si128((const __m128i*)s);
+        uint32_t mask  = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, zero));
+        if (mask != 0) {
+            return (s - str) + __builtin_ctz(mask);
+        }
+        s += 16;
+    }
+}
 
-        /* Create mask from comparison */
-        uint32_t mask = _mm256_movemask_epi8(cmp);
+CPU_TARGET_AVX2 NO_ASAN static size_t strlen_avx2(const char* str) {
+    const char* s = str;
+    while (((uintptr_t)s & 31) != 0) {
+        if (*s == '\0') {
+            return s - str;
+        }
+        s++;
+    }
 
+    __m256i zero = _mm256_setzero_si256();
+    while (1) {
+        __m256i  chunk = _mm256_load_si256((const __m256i*)s);
+        uint32_t mask  = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, zero));
         if (mask != 0) {
-            /* Found a zero byte - find which one */
-            int pos = __builtin_ctz(mask); // Count trailing zeros
-            return (s - str) + pos;
+            return (s - str) + __builtin_ctz(mask);
         }
-
         s += 32;
     }
 }
 
-/**
- * SIMD-optimized memcpy using AVX2
- * Processes 32 bytes at a time for bulk copying
- *
- * Note: For small sizes (<= 64 bytes), falls back to simple copy
- * to avoid AVX2 overhead
- */
-void* memcpy_simd(void* dest, const void* src, size_t n) {
-    char*       d = (char*)dest;
-    const char* s = (const char*)src;
-
-    /* For small copies, use simple byte copy (faster due to less overhead) */
-    if (n <= 64) {
-        char* d_end = d + n;
-        while (d < d_end) {
-            *d++ = *s++;
+CPU_TARGET_AVX512 NO_ASAN static size_t strlen_avx512(const char* str) {
+    const char* s = str;
+    while (((uintptr_t)s & 63) != 0) {
+        if (*s == '\0') {
+            return s - str;
         }
-        return dest;
+        s++;
     }
 
-    /* Handle unaligned start */
-    size_t misalignment = (uintptr_t)d & 31;
-    if (misalignment != 0) {
-        size_t to_align = 32 - misalignment;
-        if (to_align > n)
-            to_align = n;
-
-        for (size_t i = 0; i < to_align; i++) {
-            *d++ = *s++;
+    __m512i zero = _mm512_setzero_si512();
+    while (1) {
+        __m512i   chunk = _mm512_load_si512((const void*)s);
+        __mmask64 mask  = _mm512_cmpeq_epi8_mask(chunk, zero);
+        if (mask != 0) {
+            return (s - str) + (size_t)__builtin_ctzll(mask);
         }
-        n -= to_align;
+        s += 64;
     }
+}
 
-    /* Process 32 bytes at a time with AVX2 */
-    while (n >= 32) {
-        __m256i chunk = _mm256_loadu_si256((const __m256i*)s);
-        _mm256_storeu_si256((__m256i*)d, chunk);
+/* ============================================================================
+ * memcpy variants
+ * Small copies (<= 64 bytes) use a byte loop in every variant; larger ones
+ * move one register width at a time
+ * ============================================================================ */
 
-        d += 32;
-        s += 32;
-        n -= 32;
+static inline void copy_bytes(char* d, const char* s, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        d[i] = s[i];
     }
+}
 
-    /* Handle remaining bytes */
-    while (n > 0) {
-        *d++ = *s++;
-        n--;
+static void* memcpy_scalar(void* dest, const void* src, size_t n) {
+    return memcpy(dest, src, n);
+}
+
+CPU_TARGET_SSE42 static void* memcpy_sse42(void* dest, const void* src, size_t n) {
+    char*       d = (char*)dest;
+    const char* s = (const char*)src;
+    if (n <= 64) {
+        copy_bytes(d, s, n);
+        return dest;
     }
 
+    /* Align the destination, then 16-byte moves */
+    size_t to_align = (16 - ((uintptr_t)d & 15)) & 15;
+    copy_bytes(d, s, to_align);
+    d += to_align;
+    s += to_align;
+    n -= to_align;
+    for (; n >= 16; n -= 16, d += 16, s += 16) {
+        _mm_store_si128((__m128i*)d, _mm_loadu_si128((const __m128i*)s));
+    }
+    copy_bytes(d, s, n);
     return dest;
 }
 
-/**
- * SIMD-optimized memcpy for unaligned destinations
- * Uses unaligned stores to avoid alignment overhead
- * Better for arena allocations which may not be aligned
- *
- * Optimized for small strings (common case in parsing)
- */
-void* memcpy_simd_unaligned(void* dest, const void* src, size_t n) {
+CPU_TARGET_AVX2 static void* memcpy_avx2(void* dest, const void* src, size_t n) {
     char*       d = (char*)dest;
     const char* s = (const char*)src;
-
-    /* For very small copies, use memcpy to avoid UB */
-    if (n <= 16) {
-        /* Simple byte-by-byte copy for small sizes
-         * Compiler will optimize this to appropriate instructions */
-        for (size_t i = 0; i < n; i++) {
-            d[i] = s[i];
-        }
+    if (n <= 64) {
+        copy_bytes(d, s, n);
         return dest;
     }
 
-    /* For medium copies, use simple loop (still faster than AVX2 overhead) */
+    size_t to_align = (32 - ((uintptr_t)d & 31)) & 31;
+    copy_bytes(d, s, to_align);
+    d += to_align;
+    s += to_align;
+    n -= to_align;
+    for (; n >= 32; n -= 32, d += 32, s += 32) {
+        _mm256_store_si256((__m256i*)d, _mm256_loadu_si256((const __m256i*)s));
+    }
+    copy_bytes(d, s, n);
+    return dest;
+}
+
+CPU_TARGET_AVX512 static void* memcpy_avx512(void* dest, const void* src, size_t n) {
+    char*       d = (char*)dest;
+    const char* s = (const char*)src;
     if (n <= 64) {
-        for (size_t i = 0; i < n; i++) {
-            d[i] = s[i];
-        }
+        copy_bytes(d, s, n);
         return dest;
     }
 
-    /* For large copies, use AVX2 */
-    while (n >= 32) {
-        __m256i chunk = _mm256_loadu_si256((const __m256i*)s);
-        _mm256_storeu_si256((__m256i*)d, chunk);
+    size_t to_align = (64 - ((uintptr_t)d & 63)) & 63;
+    copy_bytes(d, s, to_align);
+    d += to_align;
+    s += to_align;
+    n -= to_align;
+    for (; n >= 64; n -= 64, d += 64, s += 64) {
+        _mm512_store_si512((void*)d, _mm512_loadu_si512((const void*)s));
+    }
+    /* Masked tail: one partial store instead of a byte loop */
+    if (n > 0) {
+        __mmask64 mask = _bzhi_u64(~0ull, (unsigned)n);
+        _mm512_mask_storeu_epi8(d, mask, _mm512_maskz_loadu_epi8(mask, s));
+    }
+    return dest;
+}
 
-        d += 32;
-        s += 32;
-        n -= 32;
+/* Unaligned destinations (arena strings): no alignment prologue */
+CPU_TARGET_SSE42 static void* memcpy_unaligned_sse42(void* dest, const void* src, size_t n) {
+    char*       d = (char*)dest;
+    const char* s = (const char*)src;
+    if (n <= 64) {
+        copy_bytes(d, s, n);
+        return dest;
+    }
+    for (; n >= 16; n -= 16, d += 16, s += 16) {
+        _mm_storeu_si128((__m128i*)d, _mm_loadu_si128((const __m128i*)s));
     }
+    copy_bytes(d, s, n);
+    return dest;
+}
 
-    /* Handle remaining bytes (0-31 bytes left)
-     * Use scalar copy for safety - trying to use SIMD with overlapping copy
-     * would read out of bounds when n < 32 (e.g., n=20 would read from s-12) */
-    for (size_t i = 0; i < n; i++) {
-        d[i] = s[i];
+CPU_TARGET_AVX2 static void* memcpy_unaligned_avx2(void* dest, const void* src, size_t n) {
+    char*       d = (char*)dest;
+    const char* s = (const char*)src;
+    if (n <= 64) {
+        copy_bytes(d, s, n);
+        return dest;
     }
+    for (; n >= 32; n -= 32, d += 32, s += 32) {
+        _mm256_storeu_si256((__m256i*)d, _mm256_loadu_si256((const __m256i*)s));
+    }
+    copy_bytes(d, s, n);
+    return dest;
+}
 
+CPU_TARGET_AVX512 static void* memcpy_unaligned_avx512(void* dest, const void* src, size_t n) {
+    char*       d = (char*)dest;
+    const char* s = (const char*)src;
+    for (; n >= 64; n -= 64, d += 64, s += 64) {
+        _mm512_storeu_si512((void*)d, _mm512_loadu_si512((const void*)s));
+    }
+    if (n > 0) {
+        __mmask64 mask = _bzhi_u64(~0ull, (unsigned)n);
+        _mm512_mask_storeu_epi8(d, mask, _mm512_maskz_loadu_epi8(mask, s));
+    }
     return dest;
 }
+
+/* ============================================================================
+ * Dispatch (indexed by cpu_simd_level())
+ * ============================================================================ */
+
+typedef size_t (*StrlenKernel)(const char*);
+typedef void* (*MemcpyKernel)(void*, const void*, size_t);
+
+static const StrlenKernel strlen_kernels[CPU_SIMD_LEVELS] = {
+    strlen_scalar, strlen_sse42, strlen_avx2, strlen_avx512};
+static const MemcpyKernel memcpy_kernels[CPU_SIMD_LEVELS] = {
+    memcpy_scalar, memcpy_sse42, memcpy_avx2, memcpy_avx512};
+static const MemcpyKernel memcpy_unaligned_kernels[CPU_SIMD_LEVELS] = {
+    memcpy_scalar, memcpy_unaligned_sse42, memcpy_unaligned_avx2, memcpy_unaligned_avx512};
+
+size_t strlen_simd(const char* str) {
+    return strlen_kernels[cpu_simd_level()](str);
+}
+
+void* memcpy_simd(void* dest, const void* src, size_t n) {
+    return memcpy_kernels[cpu_simd_level()](dest, src, n);
+}
+
+void* memcpy_simd_unaligned(void* dest, const void* src, size_t n) {
+    return memcpy_unaligned_kernels[cpu_simd_level()](dest, src, n);
+}
@@ -1,5 +1,6 @@
 #include <arena.h>
 #include <assert.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -96,9 +97,59 @@ int main(void) {
     printf(" [OK] Capacity: %zu bytes\n", capacity);
     printf(" [OK] Utilization: %.1f%%\n\n", (used * 100.0) / capacity);
 
+    /* Test 11: Merge another arena */
+    printf("Test 11: Merge arenas...\n");
+    Arena other;
+    arena_init(&other, 256);
+    char* moved = arena_strdup(&other, "Moved string");
+    arena_alloc(&other, 512); /* Second chunk */
+    size_t other_used = arena_get_used(&other);
+    arena_merge(&arena, &other);
+    assert(other.first == NULL && arena_get_used(&other) == 0);
+    assert(arena_get_used(&arena) == used + other_used);
+    assert(strcmp(moved, "Moved string") == 0);
+    assert(strcmp(new_str, "Reused arena") == 0);
+    char* after = arena_strdup(&arena, "After merge");
+    assert(strcmp(after, "After merge") == 0);
+    arena_merge(&arena, &other); /* Empty source is a no-op */
+    Arena empty = {0};
+    arena_merge(&empty, &arena);
+    assert(arena.first == NULL && strcmp(moved, "Moved string") == 0);
+    printf(" [OK] Merged %zu bytes, pointers stay valid\n\n", other_used);
+
+    /* Test 12: Aligned allocations and aligned chunks */
+    printf("Test 12: Aligned allocations...\n");
+    Arena aligned;
+    arena_init(&aligned, 100);
+    arena_alloc(&aligned, 3);
+    for (size_t align = 1; align <= 4096; align *= 2) {
+        char* p = arena_alloc_aligned(&aligned, 10, align);
+        assert(((uintptr_t)p & (align - 1)) == 0);
+        memset(p, 0xAB, 10);
+        arena_alloc(&aligned, 1); /* Knock the next offset off the boundary */
+    }
+    arena_free(&aligned);
+    const size_t chunk_aligns[] = {ARENA_ALIGN_CACHE_LINE, ARENA_ALIGN_PAGE};
+    for (size_t m = 0; m < 2; m++) {
+        arena_init_aligned(&aligned, 1000, chunk_aligns[m]);
+        assert(aligned.chunk_align >= 64 && (aligned.chunk_align & (aligned.chunk_align - 1)) == 0);
+        assert(((uintptr_t)arena_alloc(&aligned, 1) & (aligned.chunk_align - 1)) == 0);
+        /* Oversized requests get their own chunk, aligned from its start */
+        char* big = arena_alloc_aligned(&aligned, 100000, 64);
+        assert(((uintptr_t)big & 63) == 0);
+        memset(big, 0, 100000);
+        assert(arena_get_capacity(&aligned) % aligned.chunk_align == 0);
+        arena_reset(&aligned);
+        Arena plain;
+        arena_init(&plain, 256);
+        arena_merge(&aligned, &plain); /* Plain chunks mixed into an aligned arena */
+        arena_free(&aligned);
+    }
+    printf(" [OK] Pointers aligned from 1 to 4096 bytes, cache-line and page chunks\n\n");
+
     /* Cleanup */
-    arena_free(&arena);
-    printf("Test 11: Cleanup...\n");
+    arena_free(&empty);
+    printf("Test 13: Cleanup...\n");
     printf(" [OK] Arena freed\n\n");
 
     printf("=== All tests passed! ===\n");
@@ -1,6 +1,8 @@
 #include <assert.h>
+#include <cpu_dispatch.h>
 #include <erg.h>
 #include <math.h>
+#include <parallel.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -9,7 +11,10 @@
 #ifdef _WIN32
 #include <windows.h>
 #else
+#include <fcntl.h>
+#include <sys/stat.h>
 #include <sys/time.h>
+#include <unistd.h>
 #endif
 
 #define EPSILON 1e-9
@@ -28,6 +33,58 @@ static double get_time_seconds(void) {
 #endif
 }
 
+/* Synthetic ERG file covering every type size */
+#define SYNTH_PATH    "test_synthetic.erg"
+#define SYNTH_SAMPLES 1003
+
+static const char* synth_names[] = {"Time", "S.Char", "S.UChar", "S.Short", "S.UShort", "S.Int",
+                                    "S.UInt", "S.Float", "S.LongLong", "S.ULongLong", "S.Bytes3"};
+static const char* synth_types[] = {"Double", "Char", "UChar", "Short", "UShort", "Int",
+                                    "UInt", "Float", "LongLong", "ULongLong", "3 Bytes"};
+static const size_t synth_sizes[] = {8, 1, 1, 2, 2, 4, 4, 4, 8, 8, 3};
+#define SYNTH_SIGNALS (sizeof(synth_sizes) / sizeof(synth_sizes[0]))
+
+/* Deterministic raw bytes for signal col at row */
+static void synth_value(size_t col, size_t row, uint8_t* out) {
+    if (col == 0) {
+        double t = row * 0.01;
+        memcpy(out, &t, 8);
+    } else if (col == 7) {
+        float f = (float)row * 0.5f - 100.0f;
+        memcpy(out, &f, 4);
+    } else {
+        /* Always fill 8 bytes, only the first synth_sizes[col] are stored */
+        for (size_t b = 0; b < 8; b++) {
+            out[b] = (uint8_t)(row * 31 + col * 7 + b * 13);
+        }
+    }
+}
+
+static void write_synthetic_erg(void) {
+    FILE* info = fopen(SYNTH_PATH ".info", "w");
+    assert(info);
+    fprintf(info, "#INFOFILE1.1 (UTF-8) - Do not remove this line!\n");
+    fprintf(info, "File.Format = erg\nFile.ByteOrder = LittleEndian\n");
+    for (size_t i = 0; i < SYNTH_SIGNALS; i++) {
+        fprintf(info, "File.At.%zu.Name = %s\n", i + 1, synth_names[i]);
+        fprintf(info, "File.At.%zu.Type = %s\n", i + 1, synth_types[i]);
+    }
+    fclose(info);
+
+    FILE* erg = fopen(SYNTH_PATH, "wb");
+    assert(erg);
+    uint8_t header[16] = "CM-ERG";
+    fwrite(header, 1, sizeof(header), erg);
+    for (size_t row = 0; row < SYNTH_SAMPLES; row++) {
+        for (size_t col = 0; col < SYNTH_SIGNALS; col++) {
+            uint8_t value[8];
+            synth_value(col, row, value);
+            fwrite(value, 1, synth_sizes[col], erg);
+        }
+    }
+    fclose(erg);
+}
+
 /* 1. Test and benchmark initialization and parsing */
 void test_init_and_parse(const char* erg_path) {
     printf("\n=== Test 1: Initialization and Parsing ===\n");
@@ -55,36 +112,71 @@ void test_init_and_parse(const char* erg_path) {
     erg_free(&erg);
 }
 
-/* 2. Test and benchmark cold read signal (first read after parse) */
+/* Evict a file from the page cache so the next read is cold (best effort) */
+static void evict_file_cache(const char* path) {
+#if !defined(_WIN32) && defined(POSIX_FADV_DONTNEED)
+    int fd = open(path, O_RDONLY);
+    if (fd >= 0) {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+#else
+    (void)path;
+#endif
+}
+
+/* 2. Test and benchmark cold read signal under each mapping policy */
 void test_cold_read(const char* erg_path) {
     printf("\n=== Test 2: Cold Read Signal ===\n");
 
-    ERG erg;
-    erg_init(&erg, erg_path);
-    erg_parse(&erg);
-
     const char* signal_name = "Time";
 
     printf("Reading signal '%s' (cold read - first access after parse)...\n", signal_name);
 
-    double start_time = get_time_seconds();
-    double* data = (double*)erg_get_signal(&erg, signal_name);
-    double end_time = get_time_seconds();
+    static const struct {
+        const char*    name;
+        ERGOpenOptions options;
+    } policies[] = {
+        {"default",            {.advice = ERG_ADVICE_NORMAL}},
+        {"populate",           {.populate = 1}},
+        {"sequential",         {.advice = ERG_ADVICE_SEQUENTIAL}},
+        {"random",             {.advice = ERG_ADVICE_RANDOM}},
+        {"prefetch",           {.prefetch = 1}},
+        {"huge pages",         {.huge_pages = 1}},
+        {"sequential + drop",  {.advice = ERG_ADVICE_SEQUENTIAL, .drop_behind = 1}},
+    };
 
-    double elapsed_ms = (end_time - start_time) * 1000.0;
+    double reference_last = 0.0;
+    for (size_t p = 0; p < sizeof(policies) / sizeof(policies[0]); p++) {
+        evict_file_cache(erg_path);
 
-    if (data) {
-        printf("First value: %.6f\n", data[0]);
-        printf("Last value: %.6f\n", data[erg.sample_count - 1]);
-        printf("Cold read time: %.3f ms\n", elapsed_ms);
+        ERG erg;
+        erg_init(&erg, erg_path);
+
+        double start_time = get_time_seconds();
+        erg_parse_with_options(&erg, &policies[p].options);
+        double parse_time = get_time_seconds();
+        double* data = (double*)erg_get_signal(&erg, signal_name);
+        double end_time = get_time_seconds();
+
+        if (!data) {
+            printf("ERROR: Signal '%s' not found\n", signal_name);
+            exit(1);
+        }
+        if (p == 0) {
+            printf("First value: %.6f\n", data[0]);
+            printf("Last value: %.6f\n", data[erg.sample_count - 1]);
+            reference_last = data[erg.sample_count - 1];
+        }
+        assert(data[erg.sample_count - 1] == reference_last);
+
+        printf("  %-18s parse %8.3f ms, read %8.3f ms\n", policies[p].name,
+               (parse_time - start_time) * 1000.0, (end_time - parse_time) * 1000.0);
         free(data);
-    } else {
-        printf("ERROR: Signal '%s' not found\n", signal_name);
+        erg_free(&erg);
     }
 
     printf("[OK] Cold read completed\n");
-
-    erg_free(&erg);
 }
 
 /* 3. Test and benchmark hot read signal (subsequent reads) */
@@ -203,8 +295,8 @@ void test_export_csv(const char* erg_path) {
 
     for (size_t i = 0; i < num_signals; i++) {
         signal_info[i] = erg_get_signal_info(&erg, signal_names[i]);
-        signals[i] = erg_get_signal(&erg, signal_names[i]);
     }
+    erg_get_signals(&erg, signal_names, num_signals, signals);
 
     /* Create filename */
     const char* filename = "result.csv";
@@ -326,6 +418,1461 @@ void test_benchmark(const char* erg_path) {
     erg_free(&erg);
 }
 
+/* 7. Test batch extraction against single-signal extraction */
+void test_batch_extraction(const char* erg_path) {
+    printf("\n=== Test 7: Batch Extraction ===\n");
+
+    ERG erg;
+    erg_init(&erg, erg_path);
+    erg_parse(&erg);
+
+    /* Request every signal plus one unknown name */
+    size_t       count   = erg.signal_count + 1;
+    const char** names   = malloc(count * sizeof(char*));
+    void**       batch   = malloc(count * sizeof(void*));
+    assert(names && batch);
+    for (size_t i = 0; i < erg.signal_count; i++) {
+        names[i] = erg.signals[i].name;
+    }
+    names[erg.signal_count] = "No.Such.Signal";
+
+    double start_time = get_time_seconds();
+    size_t found      = erg_get_signals(&erg, names, count, batch);
+    double batch_ms   = (get_time_seconds() - start_time) * 1000.0;
+
+    if (found != erg.signal_count || batch[erg.signal_count] != NULL) {
+        fprintf(stderr, "ERROR: Batch extraction found %zu of %zu signals\n", found, erg.signal_count);
+        exit(1);
+    }
+
+    start_time = get_time_seconds();
+    for (size_t i = 0; i < erg.signal_count; i++) {
+        void* single = erg_get_signal(&erg, names[i]);
+        if (memcmp(single, batch[i], erg.sample_count * erg.signals[i].type_size) != 0) {
+            fprintf(stderr, "ERROR: Batch data mismatch for signal '%s'\n", names[i]);
+            exit(1);
+        }
+        free(single);
+    }
+    double single_ms = (get_time_seconds() - start_time) * 1000.0;
+
+    printf("Batch extraction of %zu signals: %.3f ms\n", found, batch_ms);
+    printf("Per-signal extraction (incl. compare): %.3f ms\n", single_ms);
+
+    for (size_t i = 0; i < count; i++) {
+        free(batch[i]);
+    }
+    free(batch);
+    free(names);
+
+    printf("[OK] Batch extraction matches single-signal extraction\n");
+    erg_free(&erg);
+}
+
+/* 8. Test columnar mode against row-major extraction */
+void test_columnar(const char* erg_path) {
+    printf("\n=== Test 8: Columnar Transpose ===\n");
+
+    ERG row_erg, col_erg;
+    erg_init(&row_erg, erg_path);
+    erg_parse(&row_erg);
+    erg_init(&col_erg, erg_path);
+    erg_parse(&col_erg);
+
+    double start_time = get_time_seconds();
+    erg_enable_columnar(&col_erg);
+    double transpose_ms = (get_time_seconds() - start_time) * 1000.0;
+    assert(col_erg.columnar_data != NULL);
+
+    double row_ms = 0.0, col_ms = 0.0;
+    for (size_t i = 0; i < row_erg.signal_count; i++) {
+        const char* name = row_erg.signals[i].name;
+
+        start_time     = get_time_seconds();
+        void* row_data = erg_get_signal(&row_erg, name);
+        row_ms += (get_time_seconds() - start_time) * 1000.0;
+
+        start_time     = get_time_seconds();
+        void* col_data = erg_get_signal(&col_erg, name);
+        col_ms += (get_time_seconds() - start_time) * 1000.0;
+
+        if (memcmp(row_data, col_data, row_erg.sample_count * row_erg.signals[i].type_size) != 0) {
+            fprintf(stderr, "ERROR: Columnar data mismatch for signal '%s'\n", name);
+            exit(1);
+        }
+        free(row_data);
+        free(col_data);
+    }
+
+    printf("Transpose time: %.3f ms\n", transpose_ms);
+    printf("All signals, row-major: %.3f ms\n", row_ms);
+    printf("All signals, columnar:  %.3f ms\n", col_ms);
+    printf("[OK] Columnar extraction matches row-major extraction\n");
+
+    erg_free(&col_erg);
+    erg_free(&row_erg);
+}
+
+/* 9. Test extraction kernels for every type size */
+void test_type_kernels(void) {
+    printf("\n=== Test 9: Type-Specialized Extraction ===\n");
+
+    write_synthetic_erg();
+
+    ERG erg;
+    erg_init(&erg, SYNTH_PATH);
+    erg_parse(&erg);
+    assert(erg.signal_count == SYNTH_SIGNALS);
+    assert(erg.sample_count == SYNTH_SAMPLES);
+
+    for (size_t col = 0; col < SYNTH_SIGNALS; col++) {
+        uint8_t* data = erg_get_signal(&erg, synth_names[col]);
+        assert(data != NULL);
+        for (size_t row = 0; row < SYNTH_SAMPLES; row++) {
+            uint8_t expected[8];
+            synth_value(col, row, expected);
+            if (memcmp(data + row * synth_sizes[col], expected, synth_sizes[col]) != 0) {
+                fprintf(stderr, "ERROR: %s mismatch at row %zu\n", synth_names[col], row);
+                exit(1);
+            }
+        }
+        printf("  %-12s (%zu bytes): %d samples OK\n", synth_names[col], synth_sizes[col], SYNTH_SAMPLES);
+        free(data);
+    }
+
+    printf("[OK] All type sizes extracted correctly\n");
+    erg_free(&erg);
+}
+
+/* 10. Test extraction into caller-provided buffers and arenas */
+void test_zero_alloc_extraction(const char* erg_path) {
+    printf("\n=== Test 10: Zero-Allocation Extraction ===\n");
+
+    ERG erg;
+    erg_init(&erg, erg_path);
+    erg_parse(&erg);
+
+    /* One reusable buffer large enough for any signal */
+    size_t  capacity = erg.sample_count * 8;
+    void*   buffer   = malloc(capacity);
+    Arena   arena;
+    size_t* indices = malloc(erg.signal_count * sizeof(size_t));
+    void**  columns = malloc(erg.signal_count * sizeof(void*));
+    assert(buffer && indices && columns);
+    arena_init(&arena, 1024 * 1024);
+
+    for (size_t i = 0; i < erg.signal_count; i++) {
+        indices[i] = i;
+    }
+    size_t found = erg_get_signals_arena(&erg, indices, erg.signal_count, columns, &arena);
+    assert(found == erg.signal_count);
+
+    for (size_t i = 0; i < erg.signal_count; i++) {
+        size_t bytes     = erg.sample_count * erg.signals[i].type_size;
+        void*  reference = erg_get_signal(&erg, erg.signals[i].name);
+
+        size_t written = erg_get_signal_into_by_index(&erg, i, buffer, capacity);
+        if (written != erg.sample_count || memcmp(buffer, reference, bytes) != 0) {
+            fprintf(stderr, "ERROR: erg_get_signal_into_by_index mismatch for '%s'\n", erg.signals[i].name);
+            exit(1);
+        }
+        if (((uintptr_t)columns[i] & 63) != 0 || memcmp(columns[i], reference, bytes) != 0) {
+            fprintf(stderr, "ERROR: erg_get_signals_arena mismatch for '%s'\n", erg.signals[i].name);
+            exit(1);
+        }
+        free(reference);
+    }
+
+    /* Undersized buffer and unknown names are rejected without writing */
+    assert(erg_get_signal_into(&erg, "Time", buffer, 8) == 0);
+    assert(erg_get_signal_into(&erg, "No.Such.Signal", buffer, capacity) == 0);
+    size_t written = erg_get_signal_into(&erg, "Time", buffer, capacity);
+    assert(written == erg.sample_count);
+
+    double* time = erg_get_signal_arena(&erg, "Time", &arena);
+    assert(time != NULL && ((uintptr_t)time & 63) == 0);
+    assert(memcmp(time, buffer, erg.sample_count * sizeof(double)) == 0);
+
+    printf("Arena usage for %zu columns: %.2f MB\n", found, arena_get_used(&arena) / (1024.0 * 1024.0));
+
+    arena_free(&arena);
+    free(columns);
+    free(indices);
+    free(buffer);
+
+    printf("[OK] Zero-allocation extraction matches erg_get_signal\n");
+    erg_free(&erg);
+}
+
+/* 11. Test and benchmark signal lookup */
+void test_signal_lookup(const char* erg_path) {
+    printf("\n=== Test 11: Signal Lookup ===\n");
+
+    ERG erg;
+    erg_init(&erg, erg_path);
+    erg_parse(&erg);
+
+    size_t expected_offset = 0;
+    for (size_t i = 0; i < erg.signal_count; i++) {
+        int index = erg_find_signal_index(&erg, erg.signals[i].name);
+        if (index < 0 || strcmp(erg.signals[index].name, erg.signals[i].name) != 0) {
+            fprintf(stderr, "ERROR: Lookup failed for signal '%s'\n", erg.signals[i].name);
+            exit(1);
+        }
+        assert(erg.signals[i].row_offset == expected_offset);
+        expected_offset += erg.signals[i].type_size;
+    }
+    assert(expected_offset == erg.row_size);
+    assert(erg_find_signal_index(&erg, "No.Such.Signal") == -1);
+    assert(erg_find_signal_index(&erg, "") == -1);
+
+    const char* last_name  = erg.signals[erg.signal_count - 1].name;
+    const int   iterations = 100000;
+    int         checksum   = 0;
+
+    double start_time = get_time_seconds();
+    for (int iter = 0; iter < iterations; iter++) {
+        checksum += erg_find_signal_index(&erg, last_name);
+    }
+    double elapsed_ns = (get_time_seconds() - start_time) * 1e9 / iterations;
+
+    printf("Lookup of last signal '%s': %.1f ns (checksum %d)\n", last_name, elapsed_ns, checksum);
+    printf("[OK] All %zu signals resolve to their own index and row offset\n", erg.signal_count);
+    erg_free(&erg);
+}
+
+/* 12. Test sample-range reads */
+void test_range_read(const char* erg_path) {
+    printf("\n=== Test 12: Sample-Range Read ===\n");
+
+    ERG erg;
+    erg_init(&erg, erg_path);
+    erg_parse(&erg);
+
+    int index = erg_find_signal_index(&erg, "Car.v");
+    assert(index >= 0);
+    float* full   = erg_get_signal(&erg, "Car.v");
+    float* window = malloc(erg.sample_count * sizeof(float));
+    assert(full && window);
+
+    /* Window in the middle, window clamped at the end, and out-of-range start */
+    size_t first   = erg.sample_count / 3;
+    size_t written = erg_get_signal_range(&erg, (size_t)index, first, 100, window);
+    assert(written == 100);
+    assert(memcmp(window, full + first, 100 * sizeof(float)) == 0);
+
+    first   = erg.sample_count - 10;
+    written = erg_get_signal_range(&erg, (size_t)index, first, 100, window);
+    assert(written == 10);
+    assert(memcmp(window, full + first, 10 * sizeof(float)) == 0);
+
+    assert(erg_get_signal_range(&erg, (size_t)index, erg.sample_count, 1, window) == 0);
+    assert(erg_get_signal_range(&erg, erg.signal_count, 0, 1, window) == 0);
+
+    double start_time = get_time_seconds();
+    written           = erg_get_signal_range(&erg, (size_t)index, erg.sample_count / 2, 1000, window);
+    double elapsed_us = (get_time_seconds() - start_time) * 1e6;
+    printf("Read %zu samples from the middle: %.1f us\n", written, elapsed_us);
+
+    free(window);
+    free(full);
+
+    printf("[OK] Range reads match the full signal\n");
+    erg_free(&erg);
+}
+
+/* Reference lookup: first sample with key >= value */
+static size_t brute_lower_bound(const double* keys, size_t n, double value) {
+    size_t i = 0;
+    while (i < n && keys[i] < value) {
+        i++;
+    }
+    return i;
+}
+
+/* 13. Test key-indexed sample lookup */
+void test_key_index(const char* erg_path) {
+    printf("\n=== Test 13: Key Index ===\n");
+
+    ERG erg;
+    erg_init(&erg, erg_path);
+    erg_parse(&erg);
+
+    const char* key_names[] = {"Time", "Vhcl.sRoad"};
+    for (size_t k = 0; k < 2; k++) {
+        int signal = erg_find_signal_index(&erg, key_names[k]);
+        assert(signal >= 0);
+
+        ERGKeyIndex index;
+        if (erg_key_index_init(&index, &erg, (size_t)signal) != 0) {
+            fprintf(stderr, "ERROR: Failed to index '%s'\n", key_names[k]);
+            exit(1);
+        }
+        double* keys = erg_get_signal(&erg, key_names[k]);
+        size_t  n    = erg.sample_count;
+
+        /* Keys at, between and outside the samples */
+        for (size_t q = 0; q < 200; q++) {
+            double value = keys[0] + (keys[n - 1] - keys[0]) * ((double)q / 180.0 - 0.05);
+            if (q % 3 == 0)
+                value = keys[(q * 7919) % n];
+            size_t expected = brute_lower_bound(keys, n, value);
+            size_t found    = erg_key_index_lower_bound(&erg, &index, value);
+            if (found != expected) {
+                fprintf(stderr, "ERROR: %s lower bound of %f: got %zu, expected %zu\n",
+                        key_names[k], value, found, expected);
+                exit(1);
+            }
+        }
+
+        /* Range query against a linear scan */
+        double lo = keys[n / 4], hi = keys[n / 2];
+        size_t first;
+        size_t count = erg_key_index_range(&erg, &index, lo, hi, &first);
+        size_t expected_first = brute_lower_bound(keys, n, lo);
+        size_t expected_end   = expected_first;
+        while (expected_end < n && keys[expected_end] <= hi) {
+            expected_end++;
+        }
+        assert(first == expected_first && count == expected_end - expected_first);
+
+        const int iterations = 100000;
+        double    start_time = get_time_seconds();
+        size_t    checksum   = 0;
+        for (int iter = 0; iter < iterations; iter++) {
+            checksum += erg_key_index_lower_bound(&erg, &index, keys[(iter * 7919) % n]);
+        }
+        double elapsed_ns = (get_time_seconds() - start_time) * 1e9 / iterations;
+
+        printf("  %-10s uniform=%d step=%g lookup=%.1f ns (checksum %zu)\n",
+               key_names[k], index.uniform, index.step, elapsed_ns, checksum);
+        free(keys);
+    }
+
+    size_t first;
+    size_t count = erg_find_time_range(&erg, 1.0, 3.0, &first);
+    printf("Time in [1 s, 3 s]: %zu samples starting at %zu\n", count, first);
+
+    printf("[OK] Key index lookups match a linear scan\n");
+    erg_free(&erg);
+}
+
+/* 14. Test min/max decimation against the full-resolution data */
+void test_minmax_decimation(const char* erg_path) {
+    printf("\n=== Test 14: Min/Max Decimation ===\n");
+
+    ERG erg;
+    erg_init(&erg, erg_path);
+    erg_parse(&erg);
+
+    const size_t buckets = 100;
+    ERGBucket    out[100];
+
+    for (size_t i = 0; i < erg.signal_count; i++) {
+        const ERGSignal* sig  = &erg.signals[i];
+        void*            data = erg_get_signal(&erg, sig->name);
+
+        size_t first   = 7;
+        size_t count   = erg.sample_count - 20;
+        size_t written = erg_get_signal_minmax(&erg, i, first, count, buckets, out);
+        assert(written == buckets);
+
+        for (size_t b = 0; b < written; b++) {
+            size_t start = b * count / buckets, end = (b + 1) * count / buckets;
+            double mn = INFINITY, mx = -INFINITY;
+            for (size_t row = first + start; row < first + end; row++) {
+                double v = sig->type == ERG_FLOAT   ? (double)((float*)data)[row]
+                         : sig->type == ERG_DOUBLE  ? ((double*)data)[row]
+                         : sig->type == ERG_INT     ? (double)((int32_t*)data)[row]
+                                                    : (double)((uint32_t*)data)[row];
+                if (v < mn)
+                    mn = v;
+                if (v > mx)
+                    mx = v;
+            }
+            if (mn != out[b].min || mx != out[b].max) {
+                fprintf(stderr, "ERROR: %s bucket %zu: got [%g, %g], expected [%g, %g]\n",
+                        sig->name, b, out[b].min, out[b].max, mn, mx);
+                exit(1);
+            }
+        }
+        free(data);
+    }
+
+    /* More buckets than samples yields one bucket per sample */
+    assert(erg_get_signal_minmax(&erg, 0, 0, 10, buckets, out) == 10);
+
+    int    index      = erg_find_signal_index(&erg, "Car.v");
+    double start_time = get_time_seconds();
+    erg_get_signal_minmax(&erg, (size_t)index, 0, erg.sample_count, buckets, out);
+    double elapsed_us = (get_time_seconds() - start_time) * 1e6;
+    printf("Car.v, %zu samples -> %zu buckets: %.1f us\n", erg.sample_count, buckets, elapsed_us);
+
+    printf("[OK] Decimated envelopes match the full-resolution data\n");
+    erg_free(&erg);
+}
+
+/* Compare LOD queries with direct decimation for a few windows */
+static void check_lod_queries(const ERG* erg, const ERGLod* lod) {
+    ERGBucket expected[64], got[64];
+    size_t    windows[][2] = {{0, erg->sample_count}, {5, 700}, {64, 512}, {333, 1}, {100, erg->sample_count}};
+    size_t    buckets[]    = {1, 3, 7, 64};
+
+    for (size_t i = 0; i < erg->signal_count; i++) {
+        if (erg->signals[i].type == ERG_BYTES)
+            continue;
+        for (size_t w = 0; w < sizeof(windows) / sizeof(windows[0]); w++) {
+            for (size_t n = 0; n < sizeof(buckets) / sizeof(buckets[0]); n++) {
+                size_t a = erg_get_signal_minmax(erg, i, windows[w][0], windows[w][1], buckets[n], expected);
+                size_t b = erg_lod_query(lod, erg, i, windows[w][0], windows[w][1], buckets[n], got);
+                if (a != b || memcmp(expected, got, a * sizeof(ERGBucket)) != 0) {
+                    fprintf(stderr, "ERROR: LOD query mismatch for '%s' window %zu, %zu buckets\n",
+                            erg->signals[i].name, w, buckets[n]);
+                    exit(1);
+                }
+            }
+        }
+    }
+}
+
+/* 15. Test the LOD pyramid sidecar */
+void test_lod_pyramid(void) {
+    printf("\n=== Test 15: LOD Pyramid Sidecar ===\n");
+
+    write_synthetic_erg();
+    remove(SYNTH_PATH ".lod");
+
+    ERG erg;
+    erg_init(&erg, SYNTH_PATH);
+    erg_parse(&erg);
+
+    /* No sidecar yet: open without building fails, with building succeeds */
+    ERGLod lod;
+    assert(erg_lod_open(&lod, &erg, 0) == -1);
+    double start_time = get_time_seconds();
+    if (erg_lod_open(&lod, &erg, 1) != 0) {
+        fprintf(stderr, "ERROR: Failed to build LOD sidecar\n");
+        exit(1);
+    }
+    double build_ms = (get_time_seconds() - start_time) * 1000.0;
+    printf("Built %zu levels (base %zu samples) in %.3f ms\n", lod.level_count, lod.base_bucket, build_ms);
+    check_lod_queries(&erg, &lod);
+    erg_lod_close(&lod);
+
+    /* Later opens map the existing sidecar */
+    if (erg_lod_open(&lod, &erg, 0) != 0 || lod.mapped_data == NULL) {
+        fprintf(stderr, "ERROR: Failed to reopen LOD sidecar\n");
+        exit(1);
+    }
+    check_lod_queries(&erg, &lod);
+    erg_lod_close(&lod);
+    size_t row_size = erg.row_size;
+    erg_free(&erg);
+
+#ifndef _WIN32
+    /* A same-size rewrite within the same second invalidates the sidecar too */
+    struct stat st;
+    assert(stat(SYNTH_PATH, &st) == 0);
+    struct timespec times[2] = {st.st_atim, st.st_mtim};
+    times[1].tv_nsec = (times[1].tv_nsec + 500000000) % 1000000000;
+    assert(utimensat(AT_FDCWD, SYNTH_PATH, times, 0) == 0);
+    erg_init(&erg, SYNTH_PATH);
+    erg_parse(&erg);
+    if (erg_lod_open(&lod, &erg, 0) != -1) {
+        fprintf(stderr, "ERROR: Sub-second mtime change did not invalidate LOD sidecar\n");
+        exit(1);
+    }
+    if (erg_lod_open(&lod, &erg, 1) != 0) {
+        fprintf(stderr, "ERROR: Failed to rebuild LOD sidecar after mtime change\n");
+        exit(1);
+    }
+    erg_lod_close(&lod);
+    erg_free(&erg);
+#endif
+
+    /* A changed factor in the .erg.info invalidates the (scaled) pyramid */
+    FILE* info = fopen(SYNTH_PATH ".info", "a");
+    assert(info);
+    fprintf(info, "Quantity.%s.Factor = 2.5\nQuantity.%s.Offset = -1\n", synth_names[5], synth_names[5]);
+    fclose(info);
+    erg_init(&erg, SYNTH_PATH);
+    erg_parse(&erg);
+    if (erg_lod_open(&lod, &erg, 0) != -1) {
+        fprintf(stderr, "ERROR: Changed .erg.info did not invalidate LOD sidecar\n");
+        exit(1);
+    }
+    if (erg_lod_open(&lod, &erg, 1) != 0) {
+        fprintf(stderr, "ERROR: Failed to rebuild LOD sidecar after .erg.info change\n");
+        exit(1);
+    }
+    check_lod_queries(&erg, &lod);
+    erg_lod_close(&lod);
+    erg_free(&erg);
+
+    /* Growing the .erg file invalidates the sidecar */
+    FILE* fp = fopen(SYNTH_PATH, "ab");
+    assert(fp);
+    uint8_t row[64] = {0};
+    fwrite(row, 1, row_size, fp);
+    fclose(fp);
+
+    erg_init(&erg, SYNTH_PATH);
+    erg_parse(&erg);
+    assert(erg_lod_open(&lod, &erg, 0) == -1);
+    if (erg_lod_open(&lod, &erg, 1) != 0 || lod.sample_count != erg.sample_count) {
+        fprintf(stderr, "ERROR: Failed to rebuild stale LOD sidecar\n");
+        exit(1);
+    }
+    check_lod_queries(&erg, &lod);
+    erg_lod_close(&lod);
+    erg_free(&erg);
+
+    remove(SYNTH_PATH ".lod");
+    printf("[OK] LOD queries match direct decimation; stale sidecar rebuilt\n");
+}
+
+/* Append rows [first, last) of the synthetic signal set, plus extra_bytes of the next row */
+static void append_synthetic_rows(size_t first, size_t last, size_t extra_bytes) {
+    FILE* fp = fopen(SYNTH_PATH, "ab");
+    assert(fp);
+    for (size_t row = first; row <= last; row++) {
+        uint8_t buffer[64];
+        size_t  used = 0;
+        for (size_t col = 0; col < SYNTH_SIGNALS; col++) {
+            synth_value(col, row, buffer + used);
+            used += synth_sizes[col];
+        }
+        fwrite(buffer, 1, row < last ? used : extra_bytes, fp);
+    }
+    fclose(fp);
+}
+
+/* 16. Test tail-follow refresh on a growing file */
+void test_tail_follow(void) {
+    printf("\n=== Test 16: Tail Follow ===\n");
+
+    write_synthetic_erg();
+
+    ERG erg;
+    erg_init(&erg, SYNTH_PATH);
+    erg.follow_mode = 1;
+    erg_parse(&erg);
+    assert(erg.sample_count == SYNTH_SAMPLES);
+    assert(erg_refresh(&erg) == 0);
+
+    /* One and a half rows: only the complete row is picked up */
+    append_synthetic_rows(SYNTH_SAMPLES, SYNTH_SAMPLES + 1, 20);
+    size_t added = erg_refresh(&erg);
+    assert(added == 1);
+    assert(erg.sample_count == SYNTH_SAMPLES + 1);
+
+    /* Complete the partial row and add 500 more */
+    FILE* fp = fopen(SYNTH_PATH, "ab");
+    assert(fp);
+    uint8_t buffer[64];
+    size_t  used = 0;
+    for (size_t col = 0; col < SYNTH_SIGNALS; col++) {
+        synth_value(col, SYNTH_SAMPLES + 1, buffer + used);
+        used += synth_sizes[col];
+    }
+    fwrite(buffer + 20, 1, used - 20, fp);
+    fclose(fp);
+    append_synthetic_rows(SYNTH_SAMPLES + 2, SYNTH_SAMPLES + 502, 0);
+
+    double start_time = get_time_seconds();
+    added             = erg_refresh(&erg);
+    double elapsed_us = (get_time_seconds() - start_time) * 1e6;
+    assert(added == 501);
+    printf("Refresh picked up %zu rows in %.1f us\n", added, elapsed_us);
+
+    /* Every row, old and new, reads back correctly */
+    for (size_t col = 0; col < SYNTH_SIGNALS; col++) {
+        uint8_t* data = erg_get_signal(&erg, synth_names[col]);
+        for (size_t row = 0; row < erg.sample_count; row++) {
+            uint8_t expected[8];
+            synth_value(col, row, expected);
+            if (memcmp(data + row * synth_sizes[col], expected, synth_sizes[col]) != 0) {
+                fprintf(stderr, "ERROR: %s mismatch at row %zu after refresh\n", synth_names[col], row);
+                exit(1);
+            }
+        }
+        free(data);
+    }
+
+    /* The Time index covers the new rows */
+    size_t first;
+    size_t count = erg_find_time_range(&erg, 14.0, 15.0, &first);
+    assert(erg.time_index.sample_count == erg.sample_count);
+    assert(count == 101 || count == 100);
+    assert(first == 1400 || first == 1401);
+
+    printf("[OK] Refresh extends the mapping and ignores partial rows\n");
+    erg_free(&erg);
+}
+
+/* Iterate the whole file and compare every block against full extraction */
+static void check_iterator(const ERG* erg, void* const* expected, const size_t* columns,
+                           size_t column_count, size_t block_rows, int flags) {
+    ERGIterator it;
+    erg_iter_init(&it, erg, block_rows, columns, column_count, flags);
+
+    size_t total = 0;
+    size_t rows;
+    while ((rows = erg_iter_next(&it)) > 0) {
+        assert(it.first_row == total);
+        for (size_t k = 0; k < column_count; k++) {
+            size_t         type_size = erg->signals[columns[k]].type_size;
+            const uint8_t* want      = (const uint8_t*)expected[k] + total * type_size;
+            if (memcmp(it.column_data[k], want, rows * type_size) != 0) {
+                fprintf(stderr, "ERROR: Iterator block at row %zu differs for %s (flags %d)\n",
+                        total, erg->signals[columns[k]].name, flags);
+                exit(1);
+            }
+        }
+        /* Row-major view of the block starts at the right row */
+        const uint8_t* mapped_row = (const uint8_t*)erg->mapped_data + erg->data_offset + total * erg->row_size;
+        assert(memcmp(it.row_data, mapped_row, erg->row_size) == 0);
+        total += rows;
+    }
+    assert(total == erg->sample_count);
+    assert(erg_iter_next(&it) == 0);
+    erg_iter_free(&it);
+}
+
+/* 17. Test block iterator with drop-behind and sliding window */
+void test_iterator(const char* erg_file) {
+    printf("\n=== Test 17: Row Iterator ===\n");
+
+    write_synthetic_erg();
+
+    ERG erg;
+    erg_init(&erg, SYNTH_PATH);
+    erg_parse(&erg);
+
+    size_t columns[SYNTH_SIGNALS];
+    void*  expected[SYNTH_SIGNALS];
+    for (size_t k = 0; k < SYNTH_SIGNALS; k++) {
+        columns[k]  = SYNTH_SIGNALS - 1 - k;
+        expected[k] = erg_get_signal(&erg, erg.signals[columns[k]].name);
+    }
+
+    static const int flag_sets[4] = {
+        0, ERG_ITER_DROP_BEHIND, ERG_ITER_WINDOW, ERG_ITER_DROP_BEHIND | ERG_ITER_WINDOW,
+    };
+    static const size_t block_sizes[4] = {1, 100, 1003, 0};
+    for (size_t f = 0; f < 4; f++) {
+        for (size_t b = 0; b < 4; b++) {
+            check_iterator(&erg, expected, columns, SYNTH_SIGNALS, block_sizes[b], flag_sets[f]);
+        }
+    }
+    for (size_t k = 0; k < SYNTH_SIGNALS; k++) {
+        free(expected[k]);
+    }
+    erg_free(&erg);
+    printf("[OK] Synthetic file: all block sizes and flag combinations match\n");
+
+    /* Stream the example file through a sliding window with drop-behind */
+    erg_init(&erg, erg_file);
+    erg_parse(&erg);
+
+    size_t column    = 0;
+    void*  reference = erg_get_signal(&erg, erg.signals[0].name);
+    double start     = get_time_seconds();
+    check_iterator(&erg, &reference, &column, 1, 0, ERG_ITER_DROP_BEHIND | ERG_ITER_WINDOW);
+    double elapsed   = get_time_seconds() - start;
+    free(reference);
+
+    printf("[OK] Streamed %zu rows in %.3f ms\n", erg.sample_count, elapsed * 1000.0);
+    erg_free(&erg);
+}
+
+/* 18. Test multi-threaded extraction against the single-threaded path */
+void test_parallel_extraction(void) {
+    printf("\n=== Test 18: Parallel Extraction ===\n");
+
+    /* Enough rows for several extraction blocks */
+    const size_t total_rows = 40000;
+    write_synthetic_erg();
+    append_synthetic_rows(SYNTH_SAMPLES, total_rows, 0);
+
+    ERG erg;
+    erg_init(&erg, SYNTH_PATH);
+    erg_parse(&erg);
+    assert(erg.sample_count == total_rows);
+
+    size_t indices[SYNTH_SIGNALS + 1];
+    void*  serial[SYNTH_SIGNALS + 1];
+    void*  parallel[SYNTH_SIGNALS + 1];
+    for (size_t k = 0; k < SYNTH_SIGNALS; k++) {
+        indices[k] = k;
+    }
+    indices[SYNTH_SIGNALS] = SYNTH_SIGNALS; /* Invalid index is skipped */
+
+    double start       = get_time_seconds();
+    size_t found       = erg_get_signals_by_index(&erg, indices, SYNTH_SIGNALS + 1, serial);
+    double serial_time = get_time_seconds() - start;
+    assert(found == SYNTH_SIGNALS);
+
+    static const size_t thread_counts[4] = {1, 2, 7, 0};
+    for (size_t t = 0; t < 4; t++) {
+        start                = get_time_seconds();
+        found                = erg_get_signals_parallel(&erg, indices, SYNTH_SIGNALS + 1, parallel, thread_counts[t]);
+        double parallel_time = get_time_seconds() - start;
+        assert(found == SYNTH_SIGNALS);
+        assert(parallel[SYNTH_SIGNALS] == NULL);
+
+        for (size_t k = 0; k < SYNTH_SIGNALS; k++) {
+            if (memcmp(serial[k], parallel[k], total_rows * synth_sizes[k]) != 0) {
+                fprintf(stderr, "ERROR: Parallel extraction of %s differs (%zu threads)\n",
+                        synth_names[k], thread_counts[t]);
+                exit(1);
+            }
+            free(parallel[k]);
+        }
+        printf("  %zu thread(s): %.3f ms (serial %.3f ms)\n",
+               thread_counts[t] ? thread_counts[t] : parallel_default_threads(),
+               parallel_time * 1000.0, serial_time * 1000.0);
+    }
+
+    /* Single signal */
+    double* time = erg_get_signal_parallel(&erg, "Time", 4);
+    assert(time && memcmp(time, serial[0], total_rows * sizeof(double)) == 0);
+    free(time);
+    assert(erg_get_signal_parallel(&erg, "NoSuchSignal", 4) == NULL);
+
+    for (size_t k = 0; k < SYNTH_SIGNALS; k++) {
+        free(serial[k]);
+    }
+    erg_free(&erg);
+    printf("[OK] Parallel extraction matches serial extraction\n");
+}
+
+/* 19. Test asynchronous open against the memory-mapped path */
+void test_async_open(const char* erg_path) {
+    printf("\n=== Test 19: Async Open ===\n");
+
+    ERG mapped;
+    erg_init(&mapped, erg_path);
+    erg_parse(&mapped);
+
+    static const struct {
+        const char*    name;
+        ERGReadOptions options;
+    } configs[] = {
+        {"defaults",              {0, 0, 0}},
+        {"direct, 8 KB blocks",   {1, 8192, 3}},
+        {"odd block, depth 1",    {0, 5000, 1}},
+    };
+
+    for (size_t c = 0; c < sizeof(configs) / sizeof(configs[0]); c++) {
+        evict_file_cache(erg_path);
+
+        ERG erg;
+        erg_init(&erg, erg_path);
+
+        double        start_time = get_time_seconds();
+        ERGAsyncOpen* op         = erg_open_async(&erg, &configs[c].options);
+        int           ready      = erg_open_poll(op); /* Non-blocking; usually still reading */
+        erg_open_wait(op);
+        double elapsed_ms = (get_time_seconds() - start_time) * 1000.0;
+
+        assert(erg.read_buffer != NULL);
+        assert(erg.signal_count == mapped.signal_count);
+        assert(erg.sample_count == mapped.sample_count);
+        assert(erg.time_index.sample_count == mapped.time_index.sample_count);
+        assert(memcmp(erg.read_buffer, mapped.mapped_data, mapped.mapped_size) == 0);
+
+        for (size_t i = 0; i < erg.signal_count; i++) {
+            void* expected = erg_get_signal(&mapped, mapped.signals[i].name);
+            void* actual   = erg_get_signal(&erg, erg.signals[i].name);
+            if (memcmp(expected, actual, mapped.sample_count * mapped.signals[i].type_size) != 0) {
+                fprintf(stderr, "ERROR: Async open differs for %s (%s)\n", erg.signals[i].name, configs[c].name);
+                exit(1);
+            }
+            free(expected);
+            free(actual);
+        }
+        assert(erg_refresh(&erg) == 0);
+
+        printf("  %-20s %8.3f ms (%s at first poll)\n", configs[c].name, elapsed_ms,
+               ready ? "finished" : "pending");
+        erg_free(&erg);
+    }
+
+    erg_free(&mapped);
+    printf("[OK] Async open matches memory-mapped parse\n");
+}
+
+/* Decode a synthetic sample of a numeric column (0-9) to double, unscaled */
+static double synth_raw_double(size_t col, size_t row) {
+    uint8_t b[8];
+    synth_value(col, row, b);
+    switch (col) {
+    case 0: { double v; memcpy(&v, b, 8); return v; }
+    case 1: { int8_t v; memcpy(&v, b, 1); return v; }
+    case 2: { uint8_t v; memcpy(&v, b, 1); return v; }
+    case 3: { int16_t v; memcpy(&v, b, 2); return v; }
+    case 4: { uint16_t v; memcpy(&v, b, 2); return v; }
+    case 5: { int32_t v; memcpy(&v, b, 4); return v; }
+    case 6: { uint32_t v; memcpy(&v, b, 4); return v; }
+    case 7: { float v; memcpy(&v, b, 4); return v; }
+    case 8: { int64_t v; memcpy(&v, b, 8); return (double)v; }
+    default: { uint64_t v; memcpy(&v, b, 8); return (double)v; }
+    }
+}
+
+/* Compare as_double/as_float of every numeric synthetic signal with a scalar reference */
+static void check_converted_signals(const ERG* erg, double factor, double offset) {
+    for (size_t col = 0; col + 1 < SYNTH_SIGNALS; col++) {
+        double* as_double = erg_get_signal_as_double(erg, synth_names[col]);
+        float*  as_float  = erg_get_signal_as_float(erg, synth_names[col]);
+        assert(as_double && as_float);
+        for (size_t row = 0; row < erg->sample_count; row++) {
+            double expected = col == 0 ? synth_raw_double(col, row)
+                                       : fma(synth_raw_double(col, row), factor, offset);
+            if (as_double[row] != expected || as_float[row] != (float)expected) {
+                fprintf(stderr, "ERROR: %s row %zu: got %.17g / %.9g, expected %.17g\n",
+                        synth_names[col], row, as_double[row], (double)as_float[row], expected);
+                exit(1);
+            }
+        }
+
+        /* Single-sample buckets round exactly like the converted column */
+        ERGBucket buckets[64];
+        size_t    n = erg_get_signal_minmax(erg, col, 0, 64, 64, buckets);
+        for (size_t row = 0; row < n; row++) {
+            double v = as_double[row];
+            if (buckets[row].min != v || buckets[row].max != v || buckets[row].first != v ||
+                buckets[row].last != v) {
+                fprintf(stderr, "ERROR: %s bucket %zu differs from as_double (%.17g)\n",
+                        synth_names[col], row, v);
+                exit(1);
+            }
+        }
+        free(as_double);
+        free(as_float);
+    }
+}
+
+/* 20. Test fused convert-and-scale and integer scaling */
+void test_convert_and_scale(const char* erg_path) {
+    printf("\n=== Test 20: Fused Convert and Scale ===\n");
+
+    /* Fractional factor on every column except Time */
+    const double factor = 0.01;
+    const double offset = 1.5;
+    write_synthetic_erg();
+    FILE* info = fopen(SYNTH_PATH ".info", "a");
+    assert(info);
+    for (size_t col = 1; col < SYNTH_SIGNALS; col++) {
+        fprintf(info, "Quantity.%s.Factor = %.17g\n", synth_names[col], factor);
+        fprintf(info, "Quantity.%s.Offset = %.17g\n", synth_names[col], offset);
+    }
+    fclose(info);
+
+    ERG erg;
+    erg_init(&erg, SYNTH_PATH);
+    erg_parse(&erg);
+    assert(erg_get_signal_as_double(&erg, "S.Bytes3") == NULL);
+    assert(erg_get_signal_as_double(&erg, "NoSuchSignal") == NULL);
+
+    /* Row-major gather, then columnar slices */
+    check_converted_signals(&erg, factor, offset);
+    erg_enable_columnar(&erg);
+    check_converted_signals(&erg, factor, offset);
+    printf("[OK] as_double/as_float match scalar FMA reference for all numeric types\n");
+
+    /* Native integer output is scaled in double precision, rounded and saturated */
+    int32_t* ints   = erg_get_signal(&erg, "S.Int");
+    uint8_t* uchars = erg_get_signal(&erg, "S.UChar");
+    for (size_t row = 0; row < erg.sample_count; row++) {
+        assert(ints[row] == (int32_t)round(fma(synth_raw_double(5, row), factor, offset)));
+        assert(uchars[row] == (uint8_t)round(fma(synth_raw_double(2, row), factor, offset)));
+    }
+    free(ints);
+    free(uchars);
+    erg_free(&erg);
+    printf("[OK] Integer signals with a fractional factor are scaled correctly\n");
+
+    /* Benchmark against native extraction on the example file */
+    erg_init(&erg, erg_path);
+    erg_parse(&erg);
+    const int iterations = 100;
+    double    native_ms  = 0.0;
+    double    fused_ms   = 0.0;
+    for (int i = 0; i < iterations; i++) {
+        double start = get_time_seconds();
+        void*  raw   = erg_get_signal(&erg, erg.signals[erg.signal_count - 1].name);
+        double mid   = get_time_seconds();
+        double* conv = erg_get_signal_as_double(&erg, erg.signals[erg.signal_count - 1].name);
+        double end   = get_time_seconds();
+        native_ms += (mid - start) * 1000.0;
+        fused_ms  += (end - mid) * 1000.0;
+        free(raw);
+        free(conv);
+    }
+    printf("Native: %.4f ms, as_double: %.4f ms (avg of %d)\n",
+           native_ms / iterations, fused_ms / iterations, iterations);
+    erg_free(&erg);
+}
+
+/* Overwrite the S.Float sample of one synthetic row */
+static void patch_synthetic_float(FILE* fp, size_t row, float value) {
+    size_t row_size = 0;
+    size_t column   = 0;
+    for (size_t col = 0; col < SYNTH_SIGNALS; col++) {
+        if (col == 7) {
+            column = row_size;
+        }
+        row_size += synth_sizes[col];
+    }
+    fseek(fp, (long)(16 + row * row_size + column), SEEK_SET);
+    fwrite(&value, sizeof(value), 1, fp);
+}
+
+static int close_enough(double actual, double expected, double tolerance) {
+    return fabs(actual - expected) <= tolerance * (fabs(expected) > 1.0 ? fabs(expected) : 1.0);
+}
+
+/* Compare the statistics of one signal with values computed from its extracted column */
+static void check_signal_stats(const ERG* erg, size_t index, const ERGStats* st) {
+    const char* name   = erg->signals[index].name;
+    double*     data   = erg_get_signal_as_double(erg, name);
+    size_t      finite = 0, nans = 0, infs = 0;
+    double      min = INFINITY, max = -INFINITY;
+    long double sum = 0.0L;
+    assert(data);
+    for (size_t row = 0; row < erg->sample_count; row++) {
+        if (isnan(data[row])) {
+            nans++;
+        } else if (isinf(data[row])) {
+            infs++;
+        } else {
+            finite++;
+            sum += data[row];
+            min = data[row] < min ? data[row] : min;
+            max = data[row] > max ? data[row] : max;
+        }
+    }
+    double      mean = (double)(sum / finite);
+    long double m2   = 0.0L;
+    for (size_t row = 0; row < erg->sample_count; row++) {
+        if (isfinite(data[row])) {
+            m2 += ((long double)data[row] - mean) * ((long double)data[row] - mean);
+        }
+    }
+    double variance = (double)(m2 / finite);
+
+    if (st->count != finite || st->nan_count != nans || st->inf_count != infs ||
+        st->min != min || st->max != max || !close_enough(st->mean, mean, 1e-12) ||
+        !close_enough(st->variance, variance, 1e-10) ||
+        memcmp(&st->first, &data[0], sizeof(double)) != 0 ||
+        st->last != data[erg->sample_count - 1]) {
+        fprintf(stderr, "ERROR: Statistics of %s differ (mean %.17g vs %.17g, var %.17g vs %.17g)\n",
+                name, st->mean, mean, st->variance, variance);
+        exit(1);
+    }
+    free(data);
+}
+
+/* 21. Test one-pass statistics against values computed from extracted columns */
+void test_signal_stats(const char* erg_path) {
+    printf("\n=== Test 21: Signal Statistics ===\n");
+
+    /* Synthetic file with NaN and Inf samples in the float column */
+    write_synthetic_erg();
+    FILE* fp = fopen(SYNTH_PATH, "r+b");
+    assert(fp);
+    patch_synthetic_float(fp, 0, NAN);
+    patch_synthetic_float(fp, 5, NAN);
+    patch_synthetic_float(fp, 17, INFINITY);
+    patch_synthetic_float(fp, 1000, -INFINITY);
+    fclose(fp);
+
+    ERG erg;
+    erg_init(&erg, SYNTH_PATH);
+    erg_parse(&erg);
+
+    ERGStats stats[SYNTH_SIGNALS];
+    size_t   computed = erg_compute_stats(&erg, NULL, 0, stats);
+    assert(computed == SYNTH_SIGNALS - 1);
+    assert(stats[SYNTH_SIGNALS - 1].count == 0 && isnan(stats[SYNTH_SIGNALS - 1].mean));
+
+    for (size_t col = 0; col + 1 < SYNTH_SIGNALS; col++) {
+        check_signal_stats(&erg, col, &stats[col]);
+    }
+    assert(stats[7].nan_count == 2 && stats[7].inf_count == 2 && isnan(stats[7].first));
+
+    /* Explicit selection with an invalid index */
+    size_t   selection[3] = {7, SYNTH_SIGNALS + 5, 0};
+    ERGStats picked[3];
+    assert(erg_compute_stats(&erg, selection, 3, picked) == 2);
+    assert(picked[0].mean == stats[7].mean && picked[1].count == 0 && picked[2].max == stats[0].max);
+    erg_free(&erg);
+    printf("[OK] Statistics match, NaN/Inf counted and excluded\n");
+
+    /* Wide rows (8 KB): a block holds only a few dozen rows, so the sweep
+     * must tile rows and signal groups to reduce full chunks */
+    const size_t wide = 2048, wide_rows = 5000;
+    FILE*        info = fopen(SYNTH_PATH ".info", "w");
+    assert(info);
+    fprintf(info, "#INFOFILE1.1 (UTF-8) - Do not remove this line!\n");
+    fprintf(info, "File.Format = erg\nFile.ByteOrder = LittleEndian\n");
+    for (size_t i = 0; i < wide; i++) {
+        fprintf(info, "File.At.%zu.Name = Wide.%zu\nFile.At.%zu.Type = Float\n", i + 1, i, i + 1);
+        fprintf(info, "Quantity.Wide.%zu.Factor = %zu.5\n", i, i % 4);
+    }
+    fclose(info);
+    fp = fopen(SYNTH_PATH, "wb");
+    assert(fp);
+    uint8_t header[16] = "CM-ERG";
+    fwrite(header, 1, sizeof(header), fp);
+    float* row = malloc(wide * sizeof(float));
+    assert(row);
+    for (size_t r = 0; r < wide_rows; r++) {
+        for (size_t i = 0; i < wide; i++) {
+            row[i] = (float)((r * 2654435761u + i * 40503u) % 100003) * 0.01f - 300.0f;
+        }
+        fwrite(row, sizeof(float), wide, fp);
+    }
+    free(row);
+    fclose(fp);
+
+    erg_init(&erg, SYNTH_PATH);
+    erg_parse(&erg);
+    assert(erg.signal_count == wide && erg.sample_count == wide_rows);
+    ERGStats* wide_stats = malloc(wide * sizeof(ERGStats));
+    assert(wide_stats);
+    double start_time = get_time_seconds();
+    computed          = erg_compute_stats(&erg, NULL, 0, wide_stats);
+    double wide_ms    = (get_time_seconds() - start_time) * 1000.0;
+    if (computed != wide) {
+        fprintf(stderr, "ERROR: Statistics computed for %zu of %zu wide columns\n", computed, wide);
+        exit(1);
+    }
+    for (size_t i = 0; i < wide; i++) {
+        check_signal_stats(&erg, i, &wide_stats[i]);
+    }
+    free(wide_stats);
+    erg_free(&erg);
+    remove(SYNTH_PATH);
+    remove(SYNTH_PATH ".info");
+    printf("[OK] Statistics of %zu wide columns match (%.3f ms)\n", wide, wide_ms);
+
+    /* Range check of every channel: stats sweep vs extracting every signal */
+    erg_init(&erg, erg_path);
+    erg_parse(&erg);
+    ERGStats* all = malloc(erg.signal_count * sizeof(ERGStats));
+    assert(all);
+
+    /* Baseline: extract each column, then scan it for its range and mean */
+    start_time      = get_time_seconds();
+    double checksum   = 0.0;
+    for (size_t i = 0; i < erg.signal_count; i++) {
+        double* data = erg_get_signal_as_double(&erg, erg.signals[i].name);
+        if (!data) {
+            continue;
+        }
+        double lo = data[0], hi = data[0], sum = 0.0;
+        for (size_t row = 0; row < erg.sample_count; row++) {
+            lo = data[row] < lo ? data[row] : lo;
+            hi = data[row] > hi ? data[row] : hi;
+            sum += data[row];
+        }
+        checksum += lo + hi + sum;
+        free(data);
+    }
+    double extract_ms = (get_time_seconds() - start_time) * 1000.0;
+
+    start_time      = get_time_seconds();
+    computed        = erg_compute_stats(&erg, NULL, 0, all);
+    double stats_ms = (get_time_seconds() - start_time) * 1000.0;
+
+    printf("Statistics for %zu signals: %.3f ms (extract + scan: %.3f ms, checksum %.3g)\n",
+           computed, stats_ms, extract_ms, checksum);
+    printf("  %s: min=%.6f max=%.6f mean=%.6f\n", erg.signals[0].name, all[0].min, all[0].max, all[0].mean);
+    free(all);
+    erg_free(&erg);
+}
+
+/* Compare schema, layout and data of two handles of the same file */
+static void check_same_schema(const ERG* a, const ERG* b) {
+    assert(a->signal_count == b->signal_count);
+    assert(a->sample_count == b->sample_count && a->row_size == b->row_size);
+    assert(a->data_offset == b->data_offset && a->data_size == b->data_size);
+    for (size_t i = 0; i < a->signal_count; i++) {
+        const ERGSignal* x = &a->signals[i];
+        const ERGSignal* y = &b->signals[i];
+        assert(strcmp(x->name, y->name) == 0 && strcmp(x->unit, y->unit) == 0);
+        assert(x->type == y->type && x->type_size == y->type_size && x->row_offset == y->row_offset);
+        assert(x->factor == y->factor && x->offset == y->offset);
+        assert(erg_find_signal_index(b, x->name) == (int)i);
+    }
+    assert(memcmp(&a->time_index, &b->time_index, sizeof(ERGKeyIndex)) == 0);
+}
+
+/* 22. Test the .erg.idx schema cache */
+void test_open_index(const char* erg_path) {
+    printf("\n=== Test 22: Open Index Sidecar ===\n");
+
+    write_synthetic_erg();
+    remove(SYNTH_PATH ".idx");
+
+    ERGOpenOptions options;
+    memset(&options, 0, sizeof(options));
+    options.use_index   = 1;
+    options.index_stats = 1;
+
+    /* First open parses the .erg.info and writes the cache */
+    ERG parsed;
+    erg_init(&parsed, SYNTH_PATH);
+    erg_parse_with_options(&parsed, &options);
+    assert(parsed.info != NULL && parsed.index_data == NULL);
+    FILE* idx = fopen(SYNTH_PATH ".idx", "rb");
+    assert(idx);
+    fclose(idx);
+
+    /* Second open comes from the cache */
+    ERG cached;
+    erg_init(&cached, SYNTH_PATH);
+    erg_parse_with_options(&cached, &options);
+    assert(cached.info == NULL && cached.index_data != NULL);
+    check_same_schema(&parsed, &cached);
+
+    for (size_t i = 0; i < cached.signal_count; i++) {
+        void* x = erg_get_signal(&parsed, parsed.signals[i].name);
+        void* y = erg_get_signal(&cached, cached.signals[i].name);
+        assert(memcmp(x, y, parsed.sample_count * parsed.signals[i].type_size) == 0);
+        free(x);
+        free(y);
+    }
+
+    ERGStats fresh[SYNTH_SIGNALS];
+    erg_compute_stats(&cached, NULL, 0, fresh);
+    for (size_t i = 0; i < cached.signal_count; i++) {
+        ERGStats stored;
+        int      have = erg_get_cached_stats(&cached, i, &stored);
+        assert(have == 0);
+        assert(memcmp(&stored, &fresh[i], sizeof(ERGStats)) == 0 || (isnan(stored.mean) && isnan(fresh[i].mean)));
+    }
+    erg_free(&cached);
+    printf("[OK] Cached open matches a full parse\n");
+
+    /* A changed .erg.info invalidates the cache; it is rebuilt on that open */
+    FILE* info = fopen(SYNTH_PATH ".info", "a");
+    assert(info);
+    fprintf(info, "Quantity.S.Int.Unit = m\n");
+    fclose(info);
+    erg_init(&cached, SYNTH_PATH);
+    erg_parse_with_options(&cached, &options);
+    assert(cached.info != NULL && strcmp(cached.signals[5].unit, "m") == 0);
+    erg_free(&cached);
+    erg_init(&cached, SYNTH_PATH);
+    erg_parse_with_options(&cached, &options);
+    assert(cached.info == NULL && strcmp(cached.signals[5].unit, "m") == 0);
+    erg_free(&cached);
+
+    /* A corrupt cache is ignored */
+    idx = fopen(SYNTH_PATH ".idx", "r+b");
+    assert(idx);
+    fseek(idx, 0, SEEK_SET);
+    fputc('X', idx);
+    fclose(idx);
+    erg_init(&cached, SYNTH_PATH);
+    erg_parse_with_options(&cached, &options);
+    assert(cached.info != NULL);
+    erg_free(&cached);
+    erg_free(&parsed);
+    printf("[OK] Stale and corrupt caches are rebuilt\n");
+
+    /* Reopen cost on the example file */
+    const int iterations = 50;
+    options.index_stats  = 0;
+    double times[2];
+    for (int use_index = 0; use_index < 2; use_index++) {
+        options.use_index = use_index;
+        ERG erg;
+        erg_init(&erg, erg_path);
+        erg_parse_with_options(&erg, &options); /* Writes the cache when enabled */
+        erg_free(&erg);
+
+        double start = get_time_seconds();
+        for (int i = 0; i < iterations; i++) {
+            erg_init(&erg, erg_path);
+            erg_parse_with_options(&erg, &options);
+            erg_free(&erg);
+        }
+        times[use_index] = (get_time_seconds() - start) * 1000.0 / iterations;
+    }
+    char idx_path[1024];
+    snprintf(idx_path, sizeof(idx_path), "%s.idx", erg_path);
+    remove(idx_path);
+    printf("Reopen: %.3f ms parsing .erg.info, %.3f ms from .erg.idx\n", times[0], times[1]);
+}
+
+/* 23. Test the single-pass schema scan over the .erg.info entries */
+void test_schema_scan(void) {
+    printf("\n=== Test 23: Single-Pass Schema Scan ===\n");
+
+    write_synthetic_erg();
+
+    /* Same schema with quantities first, keys shuffled, duplicates and noise */
+    FILE* info = fopen(SYNTH_PATH ".info", "w");
+    assert(info);
+    fprintf(info, "#INFOFILE1.1 (UTF-8) - Do not remove this line!\n");
+    fprintf(info, "Quantity.S.Int.Unit = m\n");
+    fprintf(info, "Quantity.S.Int.Factor = 2.5\n");
+    fprintf(info, "Quantity.S.Int.Factor = 9.0\n");
+    fprintf(info, "Quantity.Time.Unit = s\n");
+    fprintf(info, "Quantity.S.Float.Offset = -1.5\n");
+    fprintf(info, "Quantity.Unknown.Unit = kg\n");
+    fprintf(info, "Quantity.S.Int.Comment = ignored\n");
+    for (size_t i = SYNTH_SIGNALS; i-- > 0;) {
+        fprintf(info, "File.At.%zu.Type = %s\n", i + 1, synth_types[i]);
+    }
+    fprintf(info, "File.At.012.Name = Bogus\n");
+    fprintf(info, "File.At.13.Name = BeyondGap\n");
+    fprintf(info, "File.At.13.Type = Double\n");
+    for (size_t i = 0; i < SYNTH_SIGNALS; i++) {
+        fprintf(info, "File.At.%zu.Name = %s\n", i + 1, synth_names[i]);
+    }
+    fprintf(info, "File.At.1.Name = Duplicate\n");
+    fprintf(info, "File.Format = erg\nFile.ByteOrder = LittleEndian\n");
+    fclose(info);
+
+    ERG erg;
+    erg_init(&erg, SYNTH_PATH);
+    erg_parse(&erg);
+    assert(erg.signal_count == SYNTH_SIGNALS);
+    for (size_t i = 0; i < SYNTH_SIGNALS; i++) {
+        assert(strcmp(erg.signals[i].name, synth_names[i]) == 0);
+        assert(erg.signals[i].type_size == synth_sizes[i]);
+        assert(erg_find_signal_index(&erg, synth_names[i]) == (int)i);
+    }
+    assert(strcmp(erg.signals[0].unit, "s") == 0);
+    assert(strcmp(erg.signals[5].unit, "m") == 0);
+    assert(erg.signals[5].factor == 2.5 && erg.signals[5].offset == 0.0);
+    assert(erg.signals[7].offset == -1.5 && erg.signals[7].factor == 1.0);
+    assert(strcmp(erg.signals[1].unit, "") == 0);
+    assert(erg_find_signal_index(&erg, "BeyondGap") < 0);
+    erg_free(&erg);
+    printf("[OK] Shuffled, duplicated and unrelated keys resolve as before\n");
+
+    /* Wide schema: metadata cost must stay linear in the entry count */
+    const size_t wide = 5000;
+    info              = fopen(SYNTH_PATH ".info", "w");
+    assert(info);
+    fprintf(info, "#INFOFILE1.1 (UTF-8) - Do not remove this line!\n");
+    fprintf(info, "File.Format = erg\nFile.ByteOrder = LittleEndian\n");
+    for (size_t i = 0; i < wide; i++) {
+        fprintf(info, "File.At.%zu.Name = Wide.Signal.%zu\n", i + 1, i);
+        fprintf(info, "File.At.%zu.Type = Float\n", i + 1);
+    }
+    for (size_t i = 0; i < wide; i++) {
+        fprintf(info, "Quantity.Wide.Signal.%zu.Unit = u%zu\n", i, i % 7);
+        fprintf(info, "Quantity.Wide.Signal.%zu.Factor = %zu\n", i, i % 3 + 1);
+    }
+    fclose(info);
+    FILE* data = fopen(SYNTH_PATH, "wb");
+    assert(data);
+    uint8_t header[16] = "CM-ERG";
+    fwrite(header, 1, sizeof(header), data);
+    float row[5000];
+    memset(row, 0, sizeof(row));
+    fwrite(row, sizeof(float), wide, data);
+    fclose(data);
+
+    double start = get_time_seconds();
+    erg_init(&erg, SYNTH_PATH);
+    erg_parse(&erg);
+    double elapsed = (get_time_seconds() - start) * 1000.0;
+    assert(erg.signal_count == wide);
+    assert(strcmp(erg.signals[4999].name, "Wide.Signal.4999") == 0);
+    assert(strcmp(erg.signals[4999].unit, "u1") == 0 && erg.signals[4999].factor == 2.0);
+    erg_free(&erg);
+    printf("[OK] %zu-signal schema parsed in %.3f ms\n", wide, elapsed);
+
+    remove(SYNTH_PATH);
+    remove(SYNTH_PATH ".info");
+}
+
+/* Everything the dispatched kernels produce for the synthetic file */
+typedef struct {
+    void*     raw[SYNTH_SIGNALS];
+    double*   scaled[SYNTH_SIGNALS];
+    ERGStats  stats[SYNTH_SIGNALS];
+    ERGBucket buckets[2][64];
+} SimdSnapshot;
+
+static void take_simd_snapshot(const ERG* erg, SimdSnapshot* snap) {
+    for (size_t col = 0; col < SYNTH_SIGNALS; col++) {
+        snap->raw[col]    = erg_get_signal(erg, synth_names[col]);
+        snap->scaled[col] = col + 1 < SYNTH_SIGNALS ? erg_get_signal_as_double(erg, synth_names[col]) : NULL;
+    }
+    erg_compute_stats(erg, NULL, 0, snap->stats);
+    /* Double (Time) and Float columns */
+    erg_get_signal_minmax(erg, 0, 1, erg->sample_count - 1, 64, snap->buckets[0]);
+    erg_get_signal_minmax(erg, 7, 1, erg->sample_count - 1, 64, snap->buckets[1]);
+}
+
+static void free_simd_snapshot(SimdSnapshot* snap) {
+    for (size_t col = 0; col < SYNTH_SIGNALS; col++) {
+        free(snap->raw[col]);
+        free(snap->scaled[col]);
+    }
+}
+
+/* 24. Test that every SIMD level produces identical results */
+void test_simd_dispatch(const char* erg_path) {
+    printf("\n=== Test 24: Runtime SIMD Dispatch ===\n");
+
+    CpuSimdLevel active   = cpu_simd_level();
+    CpuSimdLevel detected = cpu_simd_detect();
+    printf("Detected: %s, active: %s\n", cpu_simd_level_name(detected), cpu_simd_level_name(active));
+
+    write_synthetic_erg();
+    FILE* info = fopen(SYNTH_PATH ".info", "a");
+    assert(info);
+    for (size_t col = 1; col + 1 < SYNTH_SIGNALS; col++) {
+        fprintf(info, "Quantity.%s.Factor = 0.37\n", synth_names[col]);
+        fprintf(info, "Quantity.%s.Offset = -2.5\n", synth_names[col]);
+    }
+    fclose(info);
+
+    ERG erg;
+    erg_init(&erg, SYNTH_PATH);
+    erg_parse(&erg);
+
+    static SimdSnapshot reference, current;
+    cpu_simd_set_level(CPU_SIMD_SCALAR);
+    take_simd_snapshot(&erg, &reference);
+
+    for (int level = CPU_SIMD_SSE42; level <= (int)detected; level++) {
+        cpu_simd_set_level((CpuSimdLevel)level);
+        take_simd_snapshot(&erg, &current);
+        for (size_t col = 0; col < SYNTH_SIGNALS; col++) {
+            assert(memcmp(current.raw[col], reference.raw[col], erg.sample_count * synth_sizes[col]) == 0);
+            assert(col + 1 == SYNTH_SIGNALS ||
+                   memcmp(current.scaled[col], reference.scaled[col], erg.sample_count * sizeof(double)) == 0);
+        }
+        assert(memcmp(current.stats, reference.stats, sizeof(reference.stats)) == 0);
+        assert(memcmp(current.buckets, reference.buckets, sizeof(reference.buckets)) == 0);
+        free_simd_snapshot(&current);
+    }
+    free_simd_snapshot(&reference);
+    erg_free(&erg);
+    remove(SYNTH_PATH);
+    remove(SYNTH_PATH ".info");
+    printf("[OK] Extraction, scaling, stats and min/max identical from scalar to %s\n",
+           cpu_simd_level_name(detected));
+
+    /* Columnar transpose (tile kernels) at every level against row-major reads */
+    ERG rows;
+    erg_init(&rows, erg_path);
+    erg_parse(&rows);
+    for (int level = CPU_SIMD_SCALAR; level <= (int)detected; level++) {
+        cpu_simd_set_level((CpuSimdLevel)level);
+        ERG columnar;
+        erg_init(&columnar, erg_path);
+        erg_parse(&columnar);
+        erg_enable_columnar(&columnar);
+        for (size_t i = 0; i < rows.signal_count; i++) {
+            void* expected = erg_get_signal(&rows, rows.signals[i].name);
+            void* actual   = erg_get_signal(&columnar, rows.signals[i].name);
+            assert(memcmp(expected, actual, rows.sample_count * rows.signals[i].type_size) == 0);
+            free(expected);
+            free(actual);
+        }
+        erg_free(&columnar);
+    }
+    erg_free(&rows);
+    printf("[OK] Columnar transpose identical at every level\n");
+
+    cpu_simd_set_level(active);
+}
+
+/* 25. Test non-temporal extraction of large columns into aligned arenas */
+#define STREAM_PATH    "test_stream.erg"
+#define STREAM_SAMPLES (((size_t)1 << 20) + 5)
+
+void test_streaming_extraction(void) {
+    printf("\n=== Test 25: Streaming Extraction into Aligned Arenas ===\n");
+
+    /* Two columns: an 8 MB Double column (streamed) and a 4 MB Float column */
+    FILE* info = fopen(STREAM_PATH ".info", "w");
+    assert(info);
+    fprintf(info, "File.Format = erg\nFile.ByteOrder = LittleEndian\n");
+    fprintf(info, "File.At.1.Name = Time\nFile.At.1.Type = Double\n");
+    fprintf(info, "File.At.2.Name = Speed\nFile.At.2.Type = Float\n");
+    fclose(info);
+    FILE* fp = fopen(STREAM_PATH, "wb");
+    assert(fp);
+    uint8_t header[16] = "CM-ERG";
+    fwrite(header, 1, sizeof(header), fp);
+    for (size_t row = 0; row < STREAM_SAMPLES; row++) {
+        double t = row * 0.001;
+        float  v = (float)row * 0.25f;
+        fwrite(&t, sizeof(t), 1, fp);
+        fwrite(&v, sizeof(v), 1, fp);
+    }
+    fclose(fp);
+
+    ERG erg;
+    erg_init(&erg, STREAM_PATH);
+    erg_parse(&erg);
+    assert(erg.sample_count == STREAM_SAMPLES);
+
+    CpuSimdLevel active  = cpu_simd_level();
+    uint8_t*     buffer  = malloc(STREAM_SAMPLES * sizeof(double) + 64);
+    assert(buffer);
+    for (int level = CPU_SIMD_SCALAR; level <= (int)cpu_simd_detect(); level++) {
+        cpu_simd_set_level((CpuSimdLevel)level);
+
+        Arena arena;
+        arena_init_aligned(&arena, 1024 * 1024, ARENA_ALIGN_PAGE);
+        double* time  = erg_get_signal_arena(&erg, "Time", &arena);
+        float*  speed = erg_get_signal_arena(&erg, "Speed", &arena);
+        assert(time && speed && ((uintptr_t)time & 63) == 0 && ((uintptr_t)speed & 63) == 0);
+        for (size_t row = 0; row < STREAM_SAMPLES; row++) {
+            if (time[row] != row * 0.001 || speed[row] != (float)row * 0.25f) {
+                fprintf(stderr, "ERROR: Row %zu differs at level %s\n", row,
+                        cpu_simd_level_name((CpuSimdLevel)level));
+                exit(1);
+            }
+        }
+
+        /* Destinations off the vector boundary go through a scalar prologue */
+        for (size_t shift = 8; shift < 64; shift += 24) {
+            void*  dst     = buffer + shift;
+            size_t written = erg_get_signal_into(&erg, "Time", dst, STREAM_SAMPLES * sizeof(double));
+            if (written != STREAM_SAMPLES || memcmp(dst, time, STREAM_SAMPLES * sizeof(double)) != 0) {
+                fprintf(stderr, "ERROR: Extraction at offset %zu differs at level %s\n", shift,
+                        cpu_simd_level_name((CpuSimdLevel)level));
+                exit(1);
+            }
+        }
+
+        /* The blocked multi-column sweep streams per column as well */
+        size_t indices[2] = {0, 1};
+        void*  columns[2];
+        size_t found = erg_get_signals_arena(&erg, indices, 2, columns, &arena);
+        if (found != 2 || memcmp(columns[0], time, STREAM_SAMPLES * sizeof(double)) != 0 ||
+            memcmp(columns[1], speed, STREAM_SAMPLES * sizeof(float)) != 0) {
+            fprintf(stderr, "ERROR: erg_get_signals_arena differs at level %s\n",
+                    cpu_simd_level_name((CpuSimdLevel)level));
+            exit(1);
+        }
+        arena_free(&arena);
+    }
+    cpu_simd_set_level(active);
+    free(buffer);
+    erg_free(&erg);
+    remove(STREAM_PATH);
+    remove(STREAM_PATH ".info");
+    printf("[OK] %zu-row columns identical at every level, arena columns 64-byte aligned\n",
+           (size_t)STREAM_SAMPLES);
+}
+
 int main(int argc, char* argv[]) {
     printf("=== ERG Parser Comprehensive Test Suite ===\n");
 
@@ -352,6 +1899,25 @@ int main(int argc, char* argv[]) {
     test_signal_extraction(erg_path);
     test_export_csv(erg_path);
     test_benchmark(erg_path);
+    test_batch_extraction(erg_path);
+    test_columnar(erg_path);
+    test_type_kernels();
+    test_zero_alloc_extraction(erg_path);
+    test_signal_lookup(erg_path);
+    test_range_read(erg_path);
+    test_key_index(erg_path);
+    test_minmax_decimation(erg_path);
+    test_lod_pyramid();
+    test_tail_follow();
+    test_iterator(erg_path);
+    test_parallel_extraction();
+    test_async_open(erg_path);
+    test_convert_and_scale(erg_path);
+    test_signal_stats(erg_path);
+    test_open_index(erg_path);
+    test_schema_scan();
+    test_simd_dispatch(erg_path);
+    test_streaming_extraction();
 
     printf("\n=== All Tests Passed! ===\n");
     printf("\nGenerated result.csv file for validation.\n");
@@ -1,5 +1,9 @@
 #include <assert.h>
+#include <cpu_dispatch.h>
+#include <math.h>
+#include <stdint.h>
 #include <infofile.h>
+#include <string_simd.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -204,6 +208,550 @@ void test_special_characters() {
     printf("[OK] Special characters test passed (4 entries)\n");
 }
 
+void test_key_index() {
+    printf("Testing hashed key lookups...\n");
+
+    const char* test_data =
+        "Dup = first\n"
+        "Dup = second\n"
+        "Multi:\n"
+        "\tfirst\n"
+        "Multi = second\n"
+        "A = short\n"
+        "A.B = longer\n"
+        "Empty =\n";
+
+    InfoFile info;
+    infofile_init(&info);
+    infofile_parse_string(test_data, strlen(test_data), &info);
+    assert(info.count == 7);
+
+    // First occurrence of a duplicated key wins, as with a linear scan
+    assert(strcmp(infofile_get(&info, "Dup"), "first") == 0);
+    assert(strcmp(infofile_get(&info, "Multi"), "first") == 0);
+    assert(strcmp(infofile_get(&info, "A"), "short") == 0);
+    assert(strcmp(infofile_get(&info, "A.B"), "longer") == 0);
+    assert(strcmp(infofile_get(&info, "Empty"), "") == 0);
+    assert(infofile_get(&info, "A.") == NULL);
+    assert(infofile_get(&info, "") == NULL);
+    assert(infofile_get(&info, "Missing") == NULL);
+
+    // Entries from later parses join the same index
+    const char* more = "Dup = third\nLate.Key = late\n";
+    infofile_parse_string(more, strlen(more), &info);
+    assert(strcmp(infofile_get(&info, "Dup"), "first") == 0);
+    assert(strcmp(infofile_get(&info, "Late.Key"), "late") == 0);
+
+    // Grow the index well past its initial size
+    const size_t key_count = 50000;
+    size_t       size      = key_count * 48;
+    char*        bulk      = malloc(size);
+    assert(bulk);
+    size_t used = 0;
+    for (size_t i = 0; i < key_count; i++) {
+        used += (size_t)snprintf(bulk + used, size - used, "Bulk.Param.%zu = %zu\n", i, i * 3);
+    }
+    infofile_parse_string(bulk, used, &info);
+    free(bulk);
+    assert(info.count == 9 + key_count);
+
+    double start = get_time_ns();
+    for (size_t i = 0; i < key_count; i++) {
+        char key[64], expected[32];
+        snprintf(key, sizeof(key), "Bulk.Param.%zu", i);
+        snprintf(expected, sizeof(expected), "%zu", i * 3);
+        const char* value = infofile_get(&info, key);
+        if (!value || strcmp(value, expected) != 0) {
+            fprintf(stderr, "ERROR: Key '%s' lookup failed\n", key);
+            exit(1);
+        }
+    }
+    double elapsed = get_time_ns() - start;
+    assert(infofile_get(&info, "Bulk.Param.50000") == NULL);
+
+    infofile_free(&info);
+    assert(infofile_get(&info, "Dup") == NULL);
+    printf("[OK] Key index test passed (%zu lookups, %.0f ns/lookup)\n", key_count, elapsed / key_count);
+}
+
+void test_prefix_queries() {
+    printf("Testing prefix and child queries...\n");
+
+    const char* test_data =
+        "Quantity.Time.Unit = s\n"
+        "Quantity.Car.v.Unit = m/s\n"
+        "File.At.2.Name = Car.v\n"
+        "Quantity.Car.v.Factor = 1.0\n"
+        "Quantity.Car-Body.Unit = -\n"
+        "Quantity.Car = leaf\n"
+        "File.At.10.Name = Car.ax\n"
+        "File.At.1.Name = Time\n"
+        "Quantity.Carrier.Unit = kg\n"
+        "File.Format = erg\n";
+
+    InfoFile info;
+    infofile_init(&info);
+    infofile_parse_string(test_data, strlen(test_data), &info);
+
+    InfoFileCursor cursor;
+    size_t         n = infofile_get_prefix(&info, "Quantity.Car.", &cursor);
+    assert(n == 2);
+    const InfoFileEntry* e = infofile_cursor_next(&cursor);
+    assert(strcmp(e->key, "Quantity.Car.v.Factor") == 0);
+    e = infofile_cursor_next(&cursor);
+    assert(strcmp(e->key, "Quantity.Car.v.Unit") == 0);
+    assert(infofile_cursor_next(&cursor) == NULL);
+
+    assert(infofile_get_prefix(&info, "Quantity.Car", &cursor) == 5);
+    assert(infofile_get_prefix(&info, "File.At.", &cursor) == 3);
+    assert(infofile_get_prefix(&info, "Nothing.", &cursor) == 0);
+    assert(infofile_cursor_next(&cursor) == NULL);
+    assert(infofile_get_prefix(&info, "", &cursor) == info.count);
+
+    // A key and its subtree are one child, even with "Car-Body" and "Carrier" around
+    InfoFileChild children[8];
+    size_t        count = infofile_get_children(&info, "Quantity", children, 8);
+    assert(count == 4);
+    const char* expected[] = {"Car", "Car-Body", "Carrier", "Time"};
+    size_t      sizes[]    = {3, 1, 1, 1};
+    for (size_t i = 0; i < count; i++) {
+        assert(children[i].name_len == strlen(expected[i]));
+        assert(strncmp(children[i].name, expected[i], children[i].name_len) == 0);
+        assert(children[i].entries.end - children[i].entries.next == sizes[i]);
+    }
+    assert(strcmp(infofile_cursor_next(&children[0].entries)->key, "Quantity.Car") == 0);
+
+    assert(infofile_get_children(&info, NULL, children, 8) == 2);
+    assert(strncmp(children[0].name, "File", children[0].name_len) == 0);
+    assert(infofile_get_children(&info, "File.At", children, 1) == 3);
+    assert(strncmp(children[0].name, "1", children[0].name_len) == 0);
+    assert(infofile_get_children(&info, "Quantity.Time.Unit", NULL, 0) == 0);
+
+    // Entries from a later parse are merged into the sorted index
+    const char* more = "Quantity.Car.ax.Unit = m/s^2\nAaa = first\n";
+    infofile_parse_string(more, strlen(more), &info);
+    assert(infofile_get_prefix(&info, "Quantity.Car.", &cursor) == 3);
+    assert(strcmp(infofile_cursor_next(&cursor)->key, "Quantity.Car.ax.Unit") == 0);
+    assert(infofile_get_children(&info, "", children, 8) == 3);
+    assert(strncmp(children[0].name, "Aaa", children[0].name_len) == 0);
+
+    // Subtree enumeration cost on a wide file
+    const size_t key_count = 50000;
+    size_t       size      = key_count * 48;
+    char*        bulk      = malloc(size);
+    assert(bulk);
+    size_t used = 0;
+    for (size_t i = 0; i < key_count; i++) {
+        used += (size_t)snprintf(bulk + used, size - used, "Tire.%zu.Param.%zu = %zu\n", i % 4, i, i);
+    }
+    infofile_parse_string(bulk, used, &info);
+    free(bulk);
+
+    double start = get_time_ns();
+    size_t total = 0;
+    for (int iter = 0; iter < 1000; iter++) {
+        total += infofile_get_prefix(&info, "Quantity.Car.", &cursor);
+        total += infofile_get_children(&info, "Tire", children, 8);
+    }
+    double elapsed = get_time_ns() - start;
+    assert(total == 1000 * (3 + 4));
+
+    infofile_free(&info);
+    printf("[OK] Prefix query test passed (%.0f ns per prefix + children query)\n", elapsed / 1000);
+}
+
+/* Check that mapping a file yields the same entries as reading it; returns entry count */
+static size_t compare_mapped(const char* filename, double* parse_ns, double* map_ns) {
+    InfoFile parsed, mapped;
+    infofile_init(&parsed);
+    infofile_init(&mapped);
+
+    double start = get_time_ns();
+    infofile_parse_file(filename, &parsed);
+    double middle = get_time_ns();
+    infofile_map_file(filename, &mapped);
+    double end = get_time_ns();
+    *parse_ns  = middle - start;
+    *map_ns    = end - middle;
+
+    assert(parsed.count == mapped.count);
+    for (size_t i = 0; i < parsed.count; i++) {
+        const InfoFileEntry* a = &parsed.entries[i];
+        const InfoFileEntry* b = &mapped.entries[i];
+        if (a->key_len != strlen(a->key) || a->value_len != strlen(a->value) ||
+            a->key_len != b->key_len || a->value_len != b->value_len ||
+            memcmp(a->key, b->key, a->key_len) != 0 || memcmp(a->value, b->value, a->value_len) != 0) {
+            fprintf(stderr, "ERROR: Mapped entry %zu differs from parsed entry '%s'\n", i, a->key);
+            exit(1);
+        }
+        // Lookups and prefix queries only ever see lengths
+        char key[512];
+        if (a->key_len < sizeof(key)) {
+            memcpy(key, a->key, a->key_len);
+            key[a->key_len] = '\0';
+            assert(infofile_get_entry(&mapped, key) != NULL);
+            assert(infofile_get_entry(&mapped, key)->value_len ==
+                   infofile_get_entry(&parsed, key)->value_len);
+            InfoFileCursor pc, mc;
+            assert(infofile_get_prefix(&parsed, key, &pc) == infofile_get_prefix(&mapped, key, &mc));
+        }
+    }
+
+    size_t count = parsed.count;
+    infofile_free(&parsed);
+    infofile_free(&mapped);
+    return count;
+}
+
+void test_mapped_parsing(const char* filename) {
+    printf("Testing memory-mapped zero-copy parsing...\n");
+
+    const char* path = "test_mapped.info";
+    FILE*       fp   = fopen(path, "wb");
+    assert(fp);
+    fprintf(fp, "#INFOFILE1.1 (UTF-8) - Do not remove this line!\r\n");
+    fprintf(fp, "File.Format = erg\r\n");
+    fprintf(fp, "Empty =\n");
+    fprintf(fp, "Comment:\n\tline one\n\tline two\n");
+    fprintf(fp, "Inline: first part\n\tsecond part\n");
+    fprintf(fp, "Quantity.Car.v.Unit = m/s\n");
+    fprintf(fp, "Quantity.Car = leaf\n");
+    fprintf(fp, "Last.Key = no newline");
+    fclose(fp);
+
+    double parse_ns, map_ns;
+    assert(compare_mapped(path, &parse_ns, &map_ns) == 7);
+
+    InfoFile info;
+    infofile_init(&info);
+    infofile_map_file(path, &info);
+    const InfoFileEntry* e = infofile_get_entry(&info, "Last.Key");
+    assert(e && e->value_len == 10 && memcmp(e->value, "no newline", 10) == 0);
+    e = infofile_get_entry(&info, "Comment");
+    assert(e && strcmp(e->value, "line one\nline two") == 0);
+    assert(infofile_get_children(&info, "Quantity", NULL, 0) == 1);
+    infofile_free(&info);
+    remove(path);
+
+    // An empty file maps to an empty InfoFile
+    fp = fopen(path, "wb");
+    assert(fp);
+    fclose(fp);
+    infofile_init(&info);
+    infofile_map_file(path, &info);
+    assert(info.count == 0 && info.mapped_data == NULL);
+    infofile_free(&info);
+    remove(path);
+    printf("[OK] Mapped entries match parsed entries\n");
+
+    if (filename) {
+        size_t count = compare_mapped(filename, &parse_ns, &map_ns);
+        printf("[OK] %s: %zu entries, read+copy %.2f ms, mapped %.2f ms\n", filename, count,
+               parse_ns / 1000000.0, map_ns / 1000000.0);
+    }
+}
+
+void test_parallel_parsing() {
+    printf("Testing parallel parsing...\n");
+
+    // Multi-line values with blank lines and comments inside them are spread
+    // through the buffer so that split points land inside them
+    size_t size = 8 * 1024 * 1024;
+    char*  text = malloc(size);
+    assert(text);
+    size_t used = 0, i = 0;
+    while (used + 512 < size) {
+        switch (i % 5) {
+        case 0:
+            used += (size_t)snprintf(text + used, size - used, "Block.%zu:\n\tfirst %zu\n\n# note\n"
+                                     "\tsecond %zu\n \t  third\n", i, i, i);
+            break;
+        case 1:
+            used += (size_t)snprintf(text + used, size - used, "Tire.%zu.Param = %zu.5\r\n", i % 97, i);
+            break;
+        case 2:
+            used += (size_t)snprintf(text + used, size - used, "  Indented.%zu = value %zu\n", i, i);
+            break;
+        case 3:
+            used += (size_t)snprintf(text + used, size - used, "Inline.%zu: head\n\ttail\n", i);
+            break;
+        default:
+            used += (size_t)snprintf(text + used, size - used, "Plain.%zu = x\n\tignored\nnoise\n", i);
+            break;
+        }
+        i++;
+    }
+
+    InfoFile expected;
+    infofile_init(&expected);
+    double start = get_time_ns();
+    infofile_parse_string(text, used, &expected);
+    double sequential = get_time_ns() - start;
+
+    const size_t thread_counts[] = {2, 3, 4, 8};
+    double       parallel        = 0.0;
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++) {
+        InfoFile info;
+        infofile_init(&info);
+        start = get_time_ns();
+        infofile_parse_string_parallel(text, used, &info, thread_counts[t]);
+        parallel = get_time_ns() - start;
+
+        assert(info.count == expected.count && info.sorted_count == expected.count);
+        for (size_t e = 0; e < info.count; e++) {
+            const InfoFileEntry* a = &expected.entries[e];
+            const InfoFileEntry* b = &info.entries[e];
+            if (strcmp(a->key, b->key) != 0 || strcmp(a->value, b->value) != 0 ||
+                a->value_len != b->value_len || expected.sorted[e] != info.sorted[e]) {
+                fprintf(stderr, "ERROR: Entry %zu differs with %zu threads ('%s')\n", e,
+                        thread_counts[t], a->key);
+                exit(1);
+            }
+        }
+        // Duplicated keys resolve to their first occurrence across chunks
+        assert(strcmp(infofile_get(&info, "Tire.1.Param"), "1.5") == 0);
+        assert(strcmp(infofile_get(&info, "Block.0"), "first 0\nsecond 0\nthird") == 0);
+        InfoFileCursor cursor;
+        assert(infofile_get_prefix(&info, "Tire.5.", &cursor) ==
+               infofile_get_prefix(&expected, "Tire.5.", &cursor));
+        infofile_free(&info);
+    }
+
+    // Small buffers and appends to a filled InfoFile take the same path
+    const char* small = "Tire.1.Param = changed\nExtra = 1\n";
+    infofile_parse_string_parallel(small, strlen(small), &expected, 4);
+    assert(strcmp(infofile_get(&expected, "Tire.1.Param"), "1.5") == 0);
+    assert(strcmp(infofile_get(&expected, "Extra"), "1") == 0);
+
+    printf("[OK] Parallel parse matches sequential parse (%zu entries, %.1f MB)\n", expected.count - 2,
+           used / (1024.0 * 1024.0));
+    printf("    Sequential: %.2f ms, parallel (8 threads): %.2f ms\n", sequential / 1000000.0,
+           parallel / 1000000.0);
+    infofile_free(&expected);
+    free(text);
+}
+
+void test_simd_dispatch() {
+    printf("Testing SIMD dispatch levels...\n");
+
+    // Lines long enough to cross 16/32/64-byte blocks at varying offsets
+    size_t size = 256 * 1024;
+    char*  text = malloc(size);
+    assert(text);
+    size_t used = 0;
+    for (size_t i = 0; used + 512 < size; i++) {
+        size_t pad = i % 70;
+        used += (size_t)snprintf(text + used, size - used, "%*sLong.Key.%zu.%.*s = value # %zu\n", (int)(pad % 40),
+                                 "", i, (int)pad, "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqr", i);
+        used += (size_t)snprintf(text + used, size - used, "# comment %.*s = not a key\n", (int)pad,
+                                 "----------------------------------------------------------------------");
+        used += (size_t)snprintf(text + used, size - used, "Array.%zu = %*s1.5\t-2 %zu  \t 3e2%*s\n", i,
+                                 (int)pad, "", i, (int)(pad / 2), "");
+        used += (size_t)snprintf(text + used, size - used, "Multi.%zu:\n\t%*sline %zu\n\tnext\n", i, (int)pad, "", i);
+    }
+
+    InfoFile reference;
+    infofile_init(&reference);
+    CpuSimdLevel active   = cpu_simd_level();
+    CpuSimdLevel detected = cpu_simd_detect();
+    cpu_simd_set_level(CPU_SIMD_SCALAR);
+    infofile_parse_string(text, used, &reference);
+    assert(reference.count > 0);
+
+    // A '#' after the separator belongs to the value at every level
+    const char* value = infofile_get(&reference, "Long.Key.0.");
+    assert(value && strcmp(value, "value # 0") == 0);
+    assert(infofile_get(&reference, "# comment") == NULL);
+
+    char src[300], dst[300];
+    for (size_t i = 0; i < sizeof(src); i++)
+        src[i] = (char)('a' + i % 26);
+
+    for (int level = CPU_SIMD_SCALAR; level <= (int)detected; level++) {
+        cpu_simd_set_level((CpuSimdLevel)level);
+        InfoFile info;
+        infofile_init(&info);
+        infofile_parse_string(text, used, &info);
+        assert(info.count == reference.count);
+        for (size_t e = 0; e < info.count; e++) {
+            const InfoFileEntry* a = &reference.entries[e];
+            const InfoFileEntry* b = &info.entries[e];
+            if (strcmp(a->key, b->key) != 0 || strcmp(a->value, b->value) != 0 || a->value_len != b->value_len) {
+                fprintf(stderr, "ERROR: Entry %zu ('%s') differs at level %s\n", e, a->key,
+                        cpu_simd_level_name((CpuSimdLevel)level));
+                exit(1);
+            }
+        }
+
+        // Token counting and splitting for numeric arrays
+        for (size_t i = 0; i < 64; i++) {
+            char key[32];
+            snprintf(key, sizeof(key), "Array.%zu", i);
+            size_t  count  = 0;
+            double* values = infofile_get_double_array(&info, key, NULL, &count);
+            assert(values && count == 4);
+            assert(values[0] == 1.5 && values[1] == -2.0 && values[2] == (double)i && values[3] == 300.0);
+        }
+
+        // strlen/memcpy kernels at every length and misalignment up to a few blocks
+        for (size_t offset = 0; offset < 8; offset++) {
+            for (size_t len = 0; len + offset + 1 < sizeof(src); len += 7) {
+                char saved       = src[offset + len];
+                src[offset + len] = '\0';
+                assert(strlen_simd(src + offset) == len);
+                src[offset + len] = saved;
+
+                memset(dst, 0, sizeof(dst));
+                memcpy_simd(dst + offset, src, len);
+                assert(memcmp(dst + offset, src, len) == 0 && dst[offset + len] == 0);
+                memset(dst, 0, sizeof(dst));
+                memcpy_simd_unaligned(dst + offset, src + 1, len);
+                assert(memcmp(dst + offset, src + 1, len) == 0 && dst[offset + len] == 0);
+            }
+        }
+        infofile_free(&info);
+    }
+
+    cpu_simd_set_level(active);
+    printf("[OK] Scalar to %s kernels agree (%zu entries, active level: %s)\n", cpu_simd_level_name(detected),
+           reference.count, cpu_simd_level_name(active));
+    infofile_free(&reference);
+    free(text);
+}
+
+/* Parse with infofile_parse_double and compare bit-for-bit with strtod */
+static void check_number(const char* text) {
+    double expected = strtod(text, NULL);
+    double actual;
+    if (infofile_parse_double(text, strlen(text), &actual) != 0 ||
+        (memcmp(&actual, &expected, sizeof(double)) != 0 && !(isnan(actual) && isnan(expected)))) {
+        fprintf(stderr, "ERROR: '%s' parsed as %.17g, strtod gives %.17g\n", text, actual, expected);
+        exit(1);
+    }
+}
+
+void test_numeric_accessors() {
+    printf("Testing numeric accessors...\n");
+
+    const char* valid[] = {"0", "-0", "+5", "1.5", ".5", "5.", "0.1", "-273.15", "1e22", "1e23",
+                           "9007199254740993", "123456789012345678901", "0.30000000000000004",
+                           "1e-400", "1e400", "2.2250738585072014e-308", "4.9e-324", "1E+5",
+                           "3.14159265358979323846264338327950288", "00000000000000000000001.5",
+                           "inf", "-nan", "0x1p3", "1.7976931348623157e308"};
+    for (size_t i = 0; i < sizeof(valid) / sizeof(valid[0]); i++)
+        check_number(valid[i]);
+
+    const char* invalid[] = {"", "-", ".", "e5", "1e", "1.5x", "1,5", " 1", "1 ", "--1", "abc"};
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+        double value;
+        assert(infofile_parse_double(invalid[i], strlen(invalid[i]), &value) == -1);
+    }
+
+    // Round trips of random doubles at full and short precision
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (int i = 0; i < 200000; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        double value;
+        if (i % 2) {
+            uint64_t bits = state;
+            memcpy(&value, &bits, sizeof(value));
+            if (!isfinite(value))
+                continue;
+        } else {
+            value = (double)(int64_t)(state >> 20) / 1e6;
+        }
+        char text[64];
+        snprintf(text, sizeof(text), (i % 3) ? "%.17g" : "%.6f", value);
+        check_number(text);
+    }
+
+    const char* test_data =
+        "Mass = 1463.0\n"
+        "Count = -42\n"
+        "Big = 9223372036854775807\n"
+        "TooBig = 9223372036854775808\n"
+        "Small = -9223372036854775808\n"
+        "Unit = kg\n"
+        "Table:\n"
+        "\t0.0 1.5 -2.25\n"
+        "\t3e2\t4\r\n"
+        "\n"
+        "\t5.5  6\n"
+        "Broken:\n"
+        "\t1 2 x 4\n";
+
+    InfoFile info;
+    infofile_init(&info);
+    infofile_parse_string(test_data, strlen(test_data), &info);
+
+    double  d;
+    int64_t n;
+    assert(infofile_get_double(&info, "Mass", &d) == 0 && d == 1463.0);
+    assert(infofile_get_double(&info, "Unit", &d) == -1);
+    assert(infofile_get_double(&info, "Missing", &d) == -1);
+    assert(infofile_get_int(&info, "Count", &n) == 0 && n == -42);
+    assert(infofile_get_int(&info, "Big", &n) == 0 && n == INT64_MAX);
+    assert(infofile_get_int(&info, "Small", &n) == 0 && n == INT64_MIN);
+    assert(infofile_get_int(&info, "TooBig", &n) == -1);
+    assert(infofile_get_int(&info, "Mass", &n) == -1);
+
+    const double expected[] = {0.0, 1.5, -2.25, 300.0, 4.0, 5.5, 6.0};
+    double       buffer[4];
+    size_t       count = 4;
+    assert(infofile_get_double_array(&info, "Table", buffer, &count) == buffer);
+    assert(count == 7 && memcmp(buffer, expected, sizeof(buffer)) == 0);
+    count          = 0;
+    double* values = infofile_get_double_array(&info, "Table", NULL, &count);
+    assert(values && count == 7 && ((uintptr_t)values % 32) == 0);
+    assert(memcmp(values, expected, sizeof(expected)) == 0);
+    assert(infofile_get_double_array(&info, "Broken", NULL, &count) == NULL && count == 2);
+    assert(infofile_get_double_array(&info, "Missing", NULL, &count) == NULL && count == 0);
+    assert(infofile_get_double_array(&info, "Mass", buffer, &count) == buffer && count == 1);
+    infofile_free(&info);
+
+    // Bulk table: arena array versus a strtod loop over a copied string
+    const size_t table_count = 200000;
+    size_t       size        = table_count * 24 + 64;
+    char*        text        = malloc(size);
+    assert(text);
+    size_t used = (size_t)snprintf(text, size, "Lookup.Table:\n");
+    for (size_t i = 0; i < table_count; i++) {
+        used += (size_t)snprintf(text + used, size - used, (i % 8 == 0) ? "\t%.6f" : " %.6f",
+                                 (double)i * 0.001 - 50.0);
+        if (i % 8 == 7)
+            text[used++] = '\n';
+    }
+    infofile_init(&info);
+    infofile_parse_string(text, used, &info);
+    free(text);
+
+    double start = get_time_ns();
+    values       = infofile_get_double_array(&info, "Lookup.Table", NULL, &count);
+    double fast  = get_time_ns() - start;
+    assert(values && count == table_count);
+
+    start        = get_time_ns();
+    char* copy   = strdup(infofile_get(&info, "Lookup.Table"));
+    char* cursor = copy;
+    double sum   = 0.0;
+    for (size_t i = 0; i < table_count; i++)
+        sum += strtod(cursor, &cursor);
+    double slow = get_time_ns() - start;
+    free(copy);
+
+    double check = 0.0;
+    for (size_t i = 0; i < table_count; i++)
+        check += values[i];
+    assert(check == sum);
+    infofile_free(&info);
+
+    printf("[OK] Numeric accessors match strtod\n");
+    printf("    %zu-value table: %.2f ms (copy + strtod %.2f ms)\n", table_count, fast / 1000000.0,
+           slow / 1000000.0);
+}
+
 void test_file_comprehensive(const char* filename, const TestCase* test_cases, size_t num_cases, const char* file_desc) {
     printf("\nTesting %s...\n", file_desc);
 
@@ -321,6 +869,14 @@ int main(int argc, char* argv[]) {
 
     // Test special characters
     test_special_characters();
+    printf("\n");
+
+    // Test hashed lookups
+    test_key_index();
+    printf("\n");
+
+    // Test prefix and child queries
+    test_prefix_queries();
 
     // Determine file paths
     const char* road_file = NULL;
@@ -360,6 +916,22 @@ int main(int argc, char* argv[]) {
         }
     }
 
+    // Test typed numeric accessors
+    printf("\n");
+    test_numeric_accessors();
+
+    // Test parallel parsing against the sequential parser
+    printf("\n");
+    test_parallel_parsing();
+
+    // Test every SIMD level against the scalar kernels
+    printf("\n");
+    test_simd_dispatch();
+
+    // Test mapped parsing against the regular parser
+    printf("\n");
+    test_mapped_parsing(road_file ? road_file : erg_file);
+
     // Test road.rd5 if available
     if (road_file) {
         test_file_comprehensive(road_file, road_test_cases, NUM_ROAD_CASES, "road.rd5 (large file)");